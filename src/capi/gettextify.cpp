@@ -0,0 +1,123 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "gettextify.h"
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <string>
+#include "../core/catalog.h"
+#include "../core/metadata.h"
+#include "../format/parser.h"
+#include "../engine/mo_compiler.h"
+
+struct gettextify_catalog {
+    gettextify::core::Catalog catalog;
+};
+
+namespace {
+
+thread_local std::string last_error;
+
+int fail(const char* message) {
+    last_error = message;
+    return GETTEXTIFY_ERROR;
+}
+
+// Runs body, translating C++ exceptions into an error code
+template <typename Body>
+int guarded(Body body) {
+    try {
+        body();
+        last_error.clear();
+        return GETTEXTIFY_OK;
+    } catch (const std::exception& ex) {
+        return fail(ex.what());
+    } catch (...) {
+        return fail("Unknown error");
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+gettextify_catalog* gettextify_catalog_new(void) {
+    return new (std::nothrow) gettextify_catalog();
+}
+
+void gettextify_catalog_free(gettextify_catalog* catalog) {
+    delete catalog;
+}
+
+int gettextify_catalog_add(gettextify_catalog* catalog,
+                           const char* msgid, size_t msgid_length,
+                           const char* msgstr, size_t msgstr_length) {
+    if (catalog == nullptr || (msgid == nullptr && msgid_length > 0) ||
+        (msgstr == nullptr && msgstr_length > 0)) {
+        return fail("Invalid argument");
+    }
+    return guarded([&]() {
+        catalog->catalog.add_entry(gettextify::core::TranslationEntry(
+            std::string(msgid, msgid_length), std::string(msgstr, msgstr_length)));
+    });
+}
+
+int gettextify_catalog_load(gettextify_catalog* catalog, const char* file_path) {
+    if (catalog == nullptr || file_path == nullptr) {
+        return fail("Invalid argument");
+    }
+    return guarded([&]() {
+        // Comments never reach the MO output
+        auto parser = gettextify::format::make_parser(file_path, ',', ".", false);
+        parser->parse(file_path, catalog->catalog);
+    });
+}
+
+size_t gettextify_catalog_size(const gettextify_catalog* catalog) {
+    return catalog != nullptr ? catalog->catalog.size() : 0;
+}
+
+int gettextify_compile_mo(const gettextify_catalog* catalog,
+                          const gettextify_metadata* metadata,
+                          uint8_t** data, size_t* size) {
+    if (catalog == nullptr || data == nullptr || size == nullptr) {
+        return fail("Invalid argument");
+    }
+    return guarded([&]() {
+        gettextify::core::Metadata header;
+        if (metadata != nullptr) {
+            auto assign = [](std::string& field, const char* value) {
+                if (value != nullptr) field = value;
+            };
+            assign(header.project_id_version, metadata->project_id_version);
+            assign(header.report_msgid_bugs_to, metadata->report_msgid_bugs_to);
+            assign(header.last_translator, metadata->last_translator);
+            assign(header.language_team, metadata->language_team);
+            assign(header.language, metadata->language);
+        }
+
+        gettextify::engine::MoCompiler compiler(header);
+        auto buffer = compiler.compile_to_buffer(catalog->catalog);
+
+        // Allocated with malloc so the caller never needs the C++ runtime to free it
+        auto* result = static_cast<uint8_t*>(std::malloc(buffer.size()));
+        if (result == nullptr) {
+            throw std::bad_alloc();
+        }
+        std::memcpy(result, buffer.data(), buffer.size());
+        *data = result;
+        *size = buffer.size();
+    });
+}
+
+void gettextify_buffer_free(uint8_t* data) {
+    std::free(data);
+}
+
+const char* gettextify_last_error(void) {
+    return last_error.c_str();
+}
+
+} // extern "C"
@@ -0,0 +1,93 @@
+/* Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+ * This code licensed under LGPL 3.0 */
+
+#ifndef GETTEXTIFY_CAPI_GETTEXTIFY_H
+#define GETTEXTIFY_CAPI_GETTEXTIFY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Same definition as core/export.h, repeated so this header stands alone */
+#ifndef GETTEXTIFY_API
+#if defined(GETTEXTIFY_STATIC)
+#define GETTEXTIFY_API
+#elif defined(_WIN32)
+#ifdef GETTEXTIFY_BUILDING_LIBRARY
+#define GETTEXTIFY_API __declspec(dllexport)
+#else
+#define GETTEXTIFY_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__)
+#define GETTEXTIFY_API __attribute__((visibility("default")))
+#else
+#define GETTEXTIFY_API
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * C interface to libgettextify
+ *
+ * Functions returning int report GETTEXTIFY_OK on success and
+ * GETTEXTIFY_ERROR on failure; gettextify_last_error() then describes the
+ * failure for the calling thread.
+ *
+ * Thread safety: every function may be called from any thread, and calls
+ * on different catalogs may run concurrently. A single catalog may be
+ * passed to gettextify_compile_mo() and gettextify_catalog_size() from
+ * several threads at once, but gettextify_catalog_add(),
+ * gettextify_catalog_load() and gettextify_catalog_free() must not run
+ * concurrently with any other call on the same catalog.
+ */
+
+#define GETTEXTIFY_OK 0
+#define GETTEXTIFY_ERROR (-1)
+
+typedef struct gettextify_catalog gettextify_catalog;
+
+/**
+ * MO header fields; NULL members keep the library defaults
+ */
+typedef struct gettextify_metadata {
+    const char* project_id_version;
+    const char* report_msgid_bugs_to;
+    const char* last_translator;
+    const char* language_team;
+    const char* language;
+} gettextify_metadata;
+
+GETTEXTIFY_API gettextify_catalog* gettextify_catalog_new(void);
+GETTEXTIFY_API void gettextify_catalog_free(gettextify_catalog* catalog);
+
+/* Strings are byte ranges and need not be NUL-terminated */
+GETTEXTIFY_API int gettextify_catalog_add(gettextify_catalog* catalog,
+                                          const char* msgid, size_t msgid_length,
+                                          const char* msgstr, size_t msgstr_length);
+
+/* Appends the entries of a CSV, JSON or MO file, chosen by extension */
+GETTEXTIFY_API int gettextify_catalog_load(gettextify_catalog* catalog, const char* file_path);
+
+GETTEXTIFY_API size_t gettextify_catalog_size(const gettextify_catalog* catalog);
+
+/**
+ * Compiles the catalog into an MO image in memory
+ *
+ * On success *data receives a buffer of *size bytes that must be released
+ * with gettextify_buffer_free(). metadata may be NULL.
+ */
+GETTEXTIFY_API int gettextify_compile_mo(const gettextify_catalog* catalog,
+                                         const gettextify_metadata* metadata,
+                                         uint8_t** data, size_t* size);
+
+GETTEXTIFY_API void gettextify_buffer_free(uint8_t* data);
+
+GETTEXTIFY_API const char* gettextify_last_error(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GETTEXTIFY_CAPI_GETTEXTIFY_H */
@@ -2,106 +2,415 @@
 // This code licensed under LGPL 3.0
 
 #include <iostream>
+#include <algorithm>
 #include <filesystem>
 #include <exception>
+#include <cstdlib>
 #include <cstring>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 #include "../core/catalog.h"
 #include "../core/metadata.h"
+#include "../core/catalog_diff.h"
+#include "../format/parser.h"
 #include "../format/csv/csv_parser.h"
+#include "../format/csv/csv_writer.h"
 #include "../engine/mo_compiler.h"
+#include "../engine/compile_pipeline.h"
+#include "../engine/cpp_generator.h"
+#include "../engine/multilingual_compiler.h"
+#include "../tm/tm_index.h"
 
 namespace fs = std::filesystem;
 
+using gettextify::format::make_parser;
+
+/**
+ * Command-line options shared by all modes
+ */
+struct Options {
+    std::vector<std::string> positional;
+    char delimiter = ',';
+    std::string key_separator = ".";
+    std::string tm_index;
+    double tm_min_score = gettextify::tm::TmIndex::DEFAULT_MIN_SCORE;
+    std::string csv_output;
+    std::string cpp_namespace = "translations";
+    std::vector<std::string> languages;
+    bool quiet = false;
+    gettextify::core::Metadata metadata;
+};
+
 void print_usage() {
-    std::cout << "Usage: gettextify <input.csv> <output.mo> [options]\n\n"
+    std::cout << "Usage: gettextify <input.csv|input.json> <output.mo|output.cpp> [options]\n"
+              << "       gettextify tm-build <index.tm> <input>... [options]\n"
+              << "       gettextify diff <old> <new> [options]\n\n"
               << "Positional arguments:\n"
               << "  input.csv              CSV file with columns: msgid,msgstr,comment\n"
-              << "  output.mo              Output MO file path\n\n"
+              << "  input.json             JSON object mapping msgids to translations\n"
+              << "  input.mo               Compiled MO file (e.g. the deployed catalog)\n"
+              << "  output.mo              Output MO file path\n"
+              << "  output.cpp             Generate C++17 lookup tables (with output.h)\n"
+              << "  out/{lang}/app.mo      One MO file per language column of a CSV input\n\n"
+              << "Inputs compressed with gzip or zstd are decompressed on the fly.\n\n"
+              << "Modes:\n"
+              << "  tm-build               Build a translation memory index from the\n"
+              << "                         translated entries of the inputs\n"
+              << "  diff                   List msgids added, removed or changed between\n"
+              << "                         two catalogs in any input format\n\n"
               << "Options:\n"
               << "  -d, --delimiter CHAR   CSV delimiter character (default: ',')\n"
+              << "  -s, --key-separator SEP\n"
+              << "                         Separator for nested JSON keys (default: '.')\n"
+              << "  --tm INDEX             Fill empty translations from a translation memory\n"
+              << "  --tm-min-score SCORE   Minimum similarity for --tm, 0 to 1 (default: 0.7)\n"
+              << "  --namespace NS         Namespace for generated C++ (default: translations)\n"
+              << "  --languages LIST       Language columns to compile, comma separated\n"
+              << "                         (default: all but msgid, msgstr and comment,\n"
+              << "                         which must then be locale codes such as pt_BR)\n"
+              << "  --csv FILE             diff: write added and changed rows as CSV\n"
+              << "  -q, --quiet            diff: print only the summary\n"
               << "  --project-id VERSION   Project-Id-Version header\n"
               << "  --bugs-to EMAIL        Report-Msgid-Bugs-To header\n"
               << "  --translator NAME      Last-Translator header\n"
               << "  --team NAME            Language-Team header\n"
               << "  --language CODE        Language code (e.g. ru, en)\n"
               << "  -h, --help             Show this help message\n\n"
-              << "Example:\n"
-              << "  gettextify input.csv output.mo -d ';' --project-id 'MyApp 2.0'\n";
+              << "Examples:\n"
+              << "  gettextify input.csv output.mo -d ';' --project-id 'MyApp 2.0'\n"
+              << "  gettextify tm-build memory.tm old/ru.csv old/ru.json\n"
+              << "  gettextify input.csv output.mo --tm memory.tm\n"
+              << "  gettextify input.csv src/strings.cpp --namespace app::i18n\n"
+              << "  gettextify all.csv 'locale/{lang}/LC_MESSAGES/app.mo' --languages ru,de\n"
+              << "  gettextify diff deployed/app.mo export.csv --csv changed.csv\n";
 }
 
-int main(int argc, char* argv[]) {
-    if (argc < 3) {
-        print_usage();
-        return 1;
-    }
-    
-    // Check for help flag
-    for (int i = 1; i < argc; ++i) {
-        if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0) {
-            print_usage();
-            return 0;
-        }
+double parse_score(const std::string& value) {
+    char* end = nullptr;
+    double score = std::strtod(value.c_str(), &end);
+    if (value.empty() || *end != '\0' || !(score >= 0.0 && score <= 1.0)) {
+        throw std::runtime_error("Invalid --tm-min-score '" + value +
+                                 "': expected a number from 0 to 1");
     }
+    return score;
+}
+
+Options parse_options(int argc, char* argv[], int first) {
+    Options options;
     
-    std::string input_file = argv[1];
-    std::string output_file = argv[2];
-    char delimiter = ',';
-    gettextify::core::Metadata metadata;
-    
-    // Parse options
-    for (int i = 3; i < argc; ++i) {
+    for (int i = first; i < argc; ++i) {
         std::string arg = argv[i];
         
         if ((arg == "-d" || arg == "--delimiter") && i + 1 < argc) {
-            delimiter = argv[++i][0];
+            options.delimiter = argv[++i][0];
+        } else if ((arg == "-s" || arg == "--key-separator") && i + 1 < argc) {
+            options.key_separator = argv[++i];
+        } else if (arg == "--tm" && i + 1 < argc) {
+            options.tm_index = argv[++i];
+        } else if (arg == "--tm-min-score" && i + 1 < argc) {
+            options.tm_min_score = parse_score(argv[++i]);
+        } else if (arg == "--namespace" && i + 1 < argc) {
+            options.cpp_namespace = argv[++i];
+        } else if (arg == "--languages" && i + 1 < argc) {
+            std::string list = argv[++i];
+            size_t start = 0;
+            while (start <= list.size()) {
+                size_t end = std::min(list.find(',', start), list.size());
+                if (end > start) {
+                    options.languages.push_back(list.substr(start, end - start));
+                }
+                start = end + 1;
+            }
+        } else if (arg == "--csv" && i + 1 < argc) {
+            options.csv_output = argv[++i];
+        } else if (arg == "-q" || arg == "--quiet") {
+            options.quiet = true;
         } else if (arg == "--project-id" && i + 1 < argc) {
-            metadata.project_id_version = argv[++i];
+            options.metadata.project_id_version = argv[++i];
         } else if (arg == "--bugs-to" && i + 1 < argc) {
-            metadata.report_msgid_bugs_to = argv[++i];
+            options.metadata.report_msgid_bugs_to = argv[++i];
         } else if (arg == "--translator" && i + 1 < argc) {
-            metadata.last_translator = argv[++i];
+            options.metadata.last_translator = argv[++i];
         } else if (arg == "--team" && i + 1 < argc) {
-            metadata.language_team = argv[++i];
+            options.metadata.language_team = argv[++i];
         } else if (arg == "--language" && i + 1 < argc) {
-            metadata.language = argv[++i];
+            options.metadata.language = argv[++i];
+        } else if (arg.size() < 2 || arg[0] != '-') {
+            options.positional.push_back(arg);
         }
     }
     
-    try {
-        if (!fs::exists(input_file)) {
-            std::cerr << "Error: Input file '" << input_file << "' not found.\n";
+    return options;
+}
+
+bool check_input(const std::string& input_file) {
+    if (!fs::exists(input_file)) {
+        std::cerr << "Error: Input file '" << input_file << "' not found.\n";
+        return false;
+    }
+    return true;
+}
+
+bool is_cpp_output(const std::string& output_file) {
+    std::string extension = fs::path(output_file).extension().string();
+    return extension == ".cpp" || extension == ".cc" || extension == ".cxx";
+}
+
+void create_parent_directory(const std::string& file_path) {
+    fs::path path(file_path);
+    if (path.has_parent_path()) {
+        fs::path dir = path.parent_path();
+        if (!fs::exists(dir)) {
+            fs::create_directories(dir);
+            std::cout << "Created directory: " << dir << "\n";
+        }
+    }
+}
+
+// Escapes control characters so each msgid stays on one terminal line
+std::string printable(const std::string& value) {
+    static const char hex[] = "0123456789abcdef";
+    std::string result;
+    result.reserve(value.size());
+    for (unsigned char c : value) {
+        switch (c) {
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            case '\\': result += "\\\\"; break;
+            default:
+                if (c < 0x20 || c == 0x7f) {
+                    result += "\\x";
+                    result += hex[c >> 4];
+                    result += hex[c & 0xf];
+                } else {
+                    result += static_cast<char>(c);
+                }
+        }
+    }
+    return result;
+}
+
+int run_tm_build(const Options& options) {
+    if (options.positional.size() < 2) {
+        print_usage();
+        return 1;
+    }
+    
+    const std::string& index_file = options.positional[0];
+    gettextify::core::Catalog catalog;
+    
+    for (size_t i = 1; i < options.positional.size(); ++i) {
+        const std::string& input_file = options.positional[i];
+        if (!check_input(input_file)) {
             return 1;
         }
-        
-        std::cout << "Converting " << input_file << " to " << output_file << "...\n";
-        
-        // Parse CSV
+        auto parser = make_parser(input_file, options.delimiter, options.key_separator, false);
+        parser->parse(input_file, catalog);
+    }
+    
+    create_parent_directory(index_file);
+    gettextify::tm::TmIndex::build(catalog, index_file);
+    
+    gettextify::tm::TmIndex index(index_file);
+    std::cout << "Indexed " << index.size() << " translated entries.\n";
+    std::cout << "Translation memory created successfully: " << index_file << "\n";
+    return 0;
+}
+
+int run_diff(const Options& options) {
+    if (options.positional.size() < 2) {
+        print_usage();
+        return 1;
+    }
+    
+    const std::string& old_file = options.positional[0];
+    const std::string& new_file = options.positional[1];
+    if (!check_input(old_file) || !check_input(new_file)) {
+        return 1;
+    }
+    
+    // Comments are not compared, only copied into the --csv output
+    bool keep_comments = !options.csv_output.empty();
+    
+    // Both sides are parsed concurrently
+    auto load = [&options, keep_comments](const std::string& input_file) {
         gettextify::core::Catalog catalog;
-        gettextify::format::csv::CsvParser parser(delimiter);
-        parser.parse(input_file, catalog);
-        
-        std::cout << "Found " << catalog.size() << " translation entries.\n";
-        
-        // Create output directory if needed
-        fs::path output_path(output_file);
-        if (output_path.has_parent_path()) {
-            fs::path output_dir = output_path.parent_path();
-            if (!fs::exists(output_dir)) {
-                fs::create_directories(output_dir);
-                std::cout << "Created directory: " << output_dir << "\n";
-            }
+        auto parser = make_parser(input_file, options.delimiter, options.key_separator,
+                                  keep_comments);
+        parser->parse(input_file, catalog);
+        return catalog;
+    };
+    auto old_future = std::async(std::launch::async, load, old_file);
+    gettextify::core::Catalog new_catalog = load(new_file);
+    gettextify::core::Catalog old_catalog = old_future.get();
+    
+    auto diff = gettextify::core::diff_catalogs(old_catalog, new_catalog);
+    
+    if (!options.quiet) {
+        for (const auto& entry : diff.added) {
+            std::cout << "+ " << printable(entry.msgid) << "\n";
+        }
+        for (const auto& entry : diff.removed) {
+            std::cout << "- " << printable(entry.msgid) << "\n";
+        }
+        for (const auto& entry : diff.changed) {
+            std::cout << "~ " << printable(entry.msgid) << "\n";
+        }
+    }
+    std::cout << diff.added.size() << " added, " << diff.removed.size() << " removed, "
+              << diff.changed.size() << " changed.\n";
+    
+    if (!options.csv_output.empty()) {
+        std::vector<gettextify::core::TranslationEntry> rows = diff.added;
+        for (const auto& entry : diff.changed) {
+            rows.emplace_back(entry.msgid, entry.new_msgstr, entry.comment);
         }
         
-        // Compile to MO
-        gettextify::engine::MoCompiler compiler(metadata);
-        compiler.compile(catalog, output_file);
+        create_parent_directory(options.csv_output);
+        gettextify::format::csv::CsvWriter writer(options.delimiter);
+        writer.write(rows, options.csv_output);
+        std::cout << "Changed rows written to: " << options.csv_output << "\n";
+    }
+    return 0;
+}
+
+int run_compile_languages(const Options& options) {
+    const std::string& input_file = options.positional[0];
+    const std::string& output_template = options.positional[1];
+    if (!check_input(input_file)) {
+        return 1;
+    }
+    if (!options.tm_index.empty()) {
+        std::cerr << "Warning: --tm is not supported with per-language output\n";
+    }
+    
+    std::cout << "Converting " << input_file << " to " << output_template << "...\n";
+    
+    gettextify::format::csv::CsvParser parser(options.delimiter);
+    parser.set_background_decompression(true);
+    auto catalog = parser.parse_multilingual(input_file, options.languages);
+    
+    std::vector<std::string> output_files;
+    for (const auto& language : catalog.get_languages()) {
+        output_files.push_back(
+            gettextify::engine::MultilingualCompiler::expand_path(output_template, language));
+        create_parent_directory(output_files.back());
+    }
+    
+    gettextify::engine::MultilingualCompiler compiler(options.metadata);
+    auto counts = compiler.compile(catalog, output_files);
+    
+    std::cout << "Found " << catalog.size() << " rows in " << catalog.get_languages().size()
+              << " languages.\n";
+    for (size_t i = 0; i < output_files.size(); ++i) {
+        std::cout << "  " << catalog.get_languages()[i] << ": " << counts[i]
+                  << " translations -> " << output_files[i] << "\n";
+    }
+    std::cout << "MO files created successfully.\n";
+    return 0;
+}
+
+int run_compile(const Options& options) {
+    if (options.positional.size() < 2) {
+        print_usage();
+        return 1;
+    }
+    
+    const std::string& input_file = options.positional[0];
+    const std::string& output_file = options.positional[1];
+    if (output_file.find(gettextify::engine::MultilingualCompiler::LANGUAGE_PLACEHOLDER) !=
+        std::string::npos) {
+        return run_compile_languages(options);
+    }
+    if (!check_input(input_file)) {
+        return 1;
+    }
+    
+    std::cout << "Converting " << input_file << " to " << output_file << "...\n";
+    
+    // Create output directory if needed
+    create_parent_directory(output_file);
+    
+    std::unique_ptr<gettextify::tm::TmIndex> memory;
+    if (!options.tm_index.empty()) {
+        memory = std::make_unique<gettextify::tm::TmIndex>(options.tm_index);
+    }
+    
+    // Comments are never compiled, so the parser does not store them
+    auto parser = make_parser(input_file, options.delimiter, options.key_separator, false);
+    size_t filled = 0;
+    auto produce = [&](gettextify::core::EntrySink& sink) {
+        if (memory) {
+            gettextify::tm::TmFillSink fill_sink(*memory, sink, options.tm_min_score);
+            parser->parse(input_file, fill_sink);
+            filled = fill_sink.filled_count();
+        } else {
+            parser->parse(input_file, sink);
+        }
+    };
+    
+    size_t count = 0;
+    std::string header_file;
+    if (is_cpp_output(output_file)) {
+        // The perfect hash needs the whole key set, so collect a catalog first
+        gettextify::core::Catalog catalog;
+        produce(catalog);
+        count = catalog.size();
         
+        header_file = fs::path(output_file).replace_extension(".h").string();
+        gettextify::engine::CppGenerator generator(options.cpp_namespace);
+        generator.generate(catalog, header_file, output_file);
+    } else {
+        // Parse and compile to MO, sorting entries while the parser runs
+        gettextify::engine::MoCompiler compiler(options.metadata);
+        gettextify::engine::CompilePipeline pipeline(compiler);
+        count = pipeline.run(produce, output_file);
+    }
+    
+    std::cout << "Found " << count << " translation entries.\n";
+    if (memory) {
+        std::cout << "Filled " << filled << " empty translations from " << options.tm_index
+                  << ".\n";
+    }
+    if (!header_file.empty()) {
+        std::cout << "C++ sources created successfully: " << header_file << ", "
+                  << output_file << "\n";
+    } else {
         std::cout << "MO file created successfully: " << output_file << "\n";
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        print_usage();
+        return 1;
+    }
+    
+    // Check for help flag
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0) {
+            print_usage();
+            return 0;
+        }
+    }
+    
+    try {
+        std::string mode = argv[1];
+        if (mode == "tm-build") {
+            return run_tm_build(parse_options(argc, argv, 2));
+        }
+        if (mode == "diff") {
+            return run_diff(parse_options(argc, argv, 2));
+        }
+        return run_compile(parse_options(argc, argv, 1));
         
     } catch (const std::exception& ex) {
         std::cerr << "Error: " << ex.what() << "\n";
         return 1;
     }
-    
-    return 0;
 }
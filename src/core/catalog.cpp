@@ -2,6 +2,7 @@
 // This code licensed under LGPL 3.0
 
 #include "catalog.h"
+#include <utility>
 
 namespace gettextify {
 namespace core {
@@ -10,6 +11,10 @@ void Catalog::add_entry(const TranslationEntry& entry) {
     entries_.push_back(entry);
 }
 
+void Catalog::add_entry(TranslationEntry&& entry) {
+    entries_.push_back(std::move(entry));
+}
+
 void Catalog::add_entry(const std::string& msgid, const std::string& msgstr, const std::string& comment) {
     entries_.emplace_back(msgid, msgstr, comment);
 }
@@ -6,6 +6,8 @@
 
 #include <vector>
 #include "translation_entry.h"
+#include "entry_sink.h"
+#include "export.h"
 
 namespace gettextify {
 namespace core {
@@ -13,11 +15,12 @@ namespace core {
 /**
  * Collection of translation entries
  */
-class Catalog {
+class GETTEXTIFY_API Catalog : public EntrySink {
 public:
     Catalog() = default;
     
     void add_entry(const TranslationEntry& entry);
+    void add_entry(TranslationEntry&& entry) override;
     void add_entry(const std::string& msgid, const std::string& msgstr, const std::string& comment = "");
     
     const std::vector<TranslationEntry>& get_entries() const;
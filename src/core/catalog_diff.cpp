@@ -0,0 +1,73 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "catalog_diff.h"
+#include <string_view>
+#include <unordered_map>
+
+namespace gettextify {
+namespace core {
+
+namespace {
+
+using MsgidIndex = std::unordered_map<std::string_view, size_t>;
+
+// Maps each msgid to the position of its last occurrence
+MsgidIndex index_entries(const std::vector<TranslationEntry>& entries) {
+    MsgidIndex index;
+    index.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (!entries[i].msgid.empty()) {
+            index[entries[i].msgid] = i;
+        }
+    }
+    return index;
+}
+
+} // namespace
+
+bool CatalogDiff::empty() const {
+    return added.empty() && removed.empty() && changed.empty();
+}
+
+CatalogDiff diff_catalogs(const Catalog& old_catalog, const Catalog& new_catalog) {
+    const auto& old_entries = old_catalog.get_entries();
+    const auto& new_entries = new_catalog.get_entries();
+    MsgidIndex old_index = index_entries(old_entries);
+    MsgidIndex new_index = index_entries(new_entries);
+    
+    CatalogDiff diff;
+    
+    for (size_t i = 0; i < new_entries.size(); ++i) {
+        const TranslationEntry& entry = new_entries[i];
+        auto self = new_index.find(entry.msgid);
+        if (self == new_index.end() || self->second != i) {
+            continue;
+        }
+        
+        auto old_it = old_index.find(entry.msgid);
+        if (old_it == old_index.end()) {
+            diff.added.push_back(entry);
+        } else if (old_entries[old_it->second].msgstr != entry.msgstr) {
+            diff.changed.push_back({entry.msgid, old_entries[old_it->second].msgstr,
+                                    entry.msgstr, entry.comment});
+        }
+    }
+    
+    for (size_t i = 0; i < old_entries.size(); ++i) {
+        const TranslationEntry& entry = old_entries[i];
+        auto self = old_index.find(entry.msgid);
+        if (self == old_index.end() || self->second != i) {
+            continue;
+        }
+        
+        if (new_index.find(entry.msgid) == new_index.end()) {
+            diff.removed.push_back(entry);
+        }
+    }
+    
+    return diff;
+}
+
+} // namespace core
+} // namespace gettextify
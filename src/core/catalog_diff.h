@@ -0,0 +1,49 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_CORE_CATALOG_DIFF_H
+#define GETTEXTIFY_CORE_CATALOG_DIFF_H
+
+#include <string>
+#include <vector>
+#include "catalog.h"
+#include "export.h"
+
+namespace gettextify {
+namespace core {
+
+/**
+ * A msgid whose translation differs between two catalogs
+ */
+struct ChangedEntry {
+    std::string msgid;
+    std::string old_msgstr;
+    std::string new_msgstr;
+    std::string comment;
+};
+
+/**
+ * Differences between two versions of a catalog, in input order
+ */
+struct GETTEXTIFY_API CatalogDiff {
+    std::vector<TranslationEntry> added;
+    std::vector<TranslationEntry> removed;
+    std::vector<ChangedEntry> changed;
+    
+    bool empty() const;
+};
+
+/**
+ * Compares two catalogs by msgid in linear time
+ *
+ * The header entry (empty msgid) is ignored. If a msgid occurs more than
+ * once in a catalog, only its last occurrence is compared. Note that the
+ * MO compiler keeps every duplicate, so a compiled catalog may resolve
+ * such a msgid to a different occurrence.
+ */
+GETTEXTIFY_API CatalogDiff diff_catalogs(const Catalog& old_catalog, const Catalog& new_catalog);
+
+} // namespace core
+} // namespace gettextify
+
+#endif // GETTEXTIFY_CORE_CATALOG_DIFF_H
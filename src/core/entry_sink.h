@@ -0,0 +1,26 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_CORE_ENTRY_SINK_H
+#define GETTEXTIFY_CORE_ENTRY_SINK_H
+
+#include "translation_entry.h"
+#include "export.h"
+
+namespace gettextify {
+namespace core {
+
+/**
+ * Receiver of translation entries produced by a parser
+ */
+class GETTEXTIFY_API EntrySink {
+public:
+    virtual ~EntrySink() = default;
+
+    virtual void add_entry(TranslationEntry&& entry) = 0;
+};
+
+} // namespace core
+} // namespace gettextify
+
+#endif // GETTEXTIFY_CORE_ENTRY_SINK_H
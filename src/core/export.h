@@ -0,0 +1,30 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_CORE_EXPORT_H
+#define GETTEXTIFY_CORE_EXPORT_H
+
+/*
+ * Marks the symbols exported from the shared library
+ *
+ * The library itself is compiled with GETTEXTIFY_BUILDING_LIBRARY and hidden
+ * default visibility. Static builds define GETTEXTIFY_STATIC for the library
+ * and its users. gettextify.h carries the same definition for C callers.
+ */
+#ifndef GETTEXTIFY_API
+#if defined(GETTEXTIFY_STATIC)
+#define GETTEXTIFY_API
+#elif defined(_WIN32)
+#ifdef GETTEXTIFY_BUILDING_LIBRARY
+#define GETTEXTIFY_API __declspec(dllexport)
+#else
+#define GETTEXTIFY_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__)
+#define GETTEXTIFY_API __attribute__((visibility("default")))
+#else
+#define GETTEXTIFY_API
+#endif
+#endif
+
+#endif // GETTEXTIFY_CORE_EXPORT_H
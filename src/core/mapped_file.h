@@ -0,0 +1,40 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_CORE_MAPPED_FILE_H
+#define GETTEXTIFY_CORE_MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+#include "export.h"
+
+namespace gettextify {
+namespace core {
+
+/**
+ * Read-only memory mapping of a whole file
+ *
+ * Falls back to reading the file into memory on platforms without mmap.
+ */
+class GETTEXTIFY_API MappedFile {
+public:
+    explicit MappedFile(const std::string& file_path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const;
+    size_t size() const;
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::string buffer_;
+};
+
+} // namespace core
+} // namespace gettextify
+
+#endif // GETTEXTIFY_CORE_MAPPED_FILE_H
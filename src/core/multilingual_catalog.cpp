@@ -0,0 +1,47 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "multilingual_catalog.h"
+#include <stdexcept>
+#include <utility>
+
+namespace gettextify {
+namespace core {
+
+MultilingualCatalog::MultilingualCatalog(std::vector<std::string> languages)
+    : languages_(std::move(languages)) {}
+
+void MultilingualCatalog::add_row(std::string msgid, std::vector<std::string>&& msgstrs) {
+    if (msgstrs.size() != languages_.size()) {
+        throw std::runtime_error("Row for '" + msgid + "' has " + std::to_string(msgstrs.size()) +
+                                 " translations, expected " + std::to_string(languages_.size()));
+    }
+    
+    msgids_.push_back(std::move(msgid));
+    for (auto& msgstr : msgstrs) {
+        msgstrs_.push_back(std::move(msgstr));
+    }
+}
+
+const std::vector<std::string>& MultilingualCatalog::get_languages() const {
+    return languages_;
+}
+
+const std::string& MultilingualCatalog::msgid(size_t row) const {
+    return msgids_[row];
+}
+
+const std::string& MultilingualCatalog::msgstr(size_t row, size_t language) const {
+    return msgstrs_[row * languages_.size() + language];
+}
+
+size_t MultilingualCatalog::size() const {
+    return msgids_.size();
+}
+
+bool MultilingualCatalog::empty() const {
+    return msgids_.empty();
+}
+
+} // namespace core
+} // namespace gettextify
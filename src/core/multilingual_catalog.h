@@ -0,0 +1,45 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_CORE_MULTILINGUAL_CATALOG_H
+#define GETTEXTIFY_CORE_MULTILINGUAL_CATALOG_H
+
+#include <string>
+#include <vector>
+#include "export.h"
+
+namespace gettextify {
+namespace core {
+
+/**
+ * Translation table with one msgid and one msgstr per language for each row
+ *
+ * Translations are kept row-major in one flat vector rather than one
+ * catalog per language, so the msgids are stored and sorted only once.
+ */
+class GETTEXTIFY_API MultilingualCatalog {
+public:
+    explicit MultilingualCatalog(std::vector<std::string> languages);
+    
+    /**
+     * Appends a row; msgstrs holds one translation per language, in order
+     */
+    void add_row(std::string msgid, std::vector<std::string>&& msgstrs);
+    
+    const std::vector<std::string>& get_languages() const;
+    const std::string& msgid(size_t row) const;
+    const std::string& msgstr(size_t row, size_t language) const;
+    
+    size_t size() const;
+    bool empty() const;
+    
+private:
+    std::vector<std::string> languages_;
+    std::vector<std::string> msgids_;
+    std::vector<std::string> msgstrs_;
+};
+
+} // namespace core
+} // namespace gettextify
+
+#endif // GETTEXTIFY_CORE_MULTILINGUAL_CATALOG_H
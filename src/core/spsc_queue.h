@@ -0,0 +1,181 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_CORE_SPSC_QUEUE_H
+#define GETTEXTIFY_CORE_SPSC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gettextify {
+namespace core {
+
+/**
+ * Bounded lock-free queue for exactly one producer and one consumer thread
+ *
+ * The blocking push()/pop() variants spin briefly while the queue is full or
+ * empty and then sleep until the other side makes progress, so a slow peer
+ * does not cost a busy core. After close() the consumer drains the remaining
+ * items and pop() then returns false. After cancel() push() returns false,
+ * which lets a consumer that gives up release a blocked producer.
+ */
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity)
+        : slots_(round_up_pow2(capacity < 2 ? 2 : capacity))
+        , mask_(slots_.size() - 1) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    bool try_push(T&& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ > mask_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ > mask_) {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        wake(consumer_waiting_, not_empty_);
+        return true;
+    }
+
+    bool try_pop(T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) {
+                return false;
+            }
+        }
+        value = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        wake(producer_waiting_, not_full_);
+        return true;
+    }
+
+    /**
+     * Returns false without pushing once the queue has been cancelled
+     */
+    bool push(T&& value) {
+        for (int spins = 0; !try_push(std::move(value)); ++spins) {
+            if (cancelled_.load(std::memory_order_acquire)) {
+                return false;
+            }
+            if (spins < SPIN_LIMIT) {
+                std::this_thread::yield();
+                continue;
+            }
+            sleep(producer_waiting_, not_full_, [this]() {
+                return tail_.load(std::memory_order_relaxed) -
+                           head_.load(std::memory_order_acquire) <= mask_ ||
+                       cancelled_.load(std::memory_order_acquire);
+            });
+        }
+        return true;
+    }
+
+    bool pop(T& value) {
+        for (int spins = 0; !try_pop(value); ++spins) {
+            if (closed_.load(std::memory_order_acquire)) {
+                // Items pushed before close() are visible now
+                return try_pop(value);
+            }
+            if (spins < SPIN_LIMIT) {
+                std::this_thread::yield();
+                continue;
+            }
+            sleep(consumer_waiting_, not_empty_, [this]() {
+                return head_.load(std::memory_order_relaxed) !=
+                           tail_.load(std::memory_order_acquire) ||
+                       closed_.load(std::memory_order_acquire);
+            });
+        }
+        return true;
+    }
+
+    void close() {
+        closed_.store(true, std::memory_order_release);
+        wake_all();
+    }
+
+    void cancel() {
+        cancelled_.store(true, std::memory_order_release);
+        wake_all();
+    }
+
+    size_t capacity() const {
+        return slots_.size();
+    }
+
+private:
+    static constexpr int SPIN_LIMIT = 64;
+
+    static size_t round_up_pow2(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // The waiter publishes its flag before re-checking the queue and the
+    // other side updates the queue before reading the flag; the fences make
+    // sure at least one of them sees the other, so no wakeup is lost
+    template <typename Ready>
+    void sleep(std::atomic<bool>& waiting, std::condition_variable& condition, Ready ready) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        condition.wait(lock, ready);
+        waiting.store(false, std::memory_order_relaxed);
+    }
+
+    void wake(std::atomic<bool>& waiting, std::condition_variable& condition) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            condition.notify_one();
+        }
+    }
+
+    void wake_all() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::lock_guard<std::mutex> lock(mutex_);
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+    std::vector<T> slots_;
+    const size_t mask_;
+    std::atomic<bool> closed_{false};
+    std::atomic<bool> cancelled_{false};
+
+    // Sleeping state, only touched once a side runs out of spins
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::atomic<bool> consumer_waiting_{false};
+    std::atomic<bool> producer_waiting_{false};
+
+    // Consumer side
+    alignas(64) std::atomic<size_t> head_{0};
+    size_t tail_cache_ = 0;
+
+    // Producer side
+    alignas(64) std::atomic<size_t> tail_{0};
+    size_t head_cache_ = 0;
+};
+
+} // namespace core
+} // namespace gettextify
+
+#endif // GETTEXTIFY_CORE_SPSC_QUEUE_H
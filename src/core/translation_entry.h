@@ -5,6 +5,7 @@
 #define GETTEXTIFY_CORE_TRANSLATION_ENTRY_H
 
 #include <string>
+#include <utility>
 
 namespace gettextify {
 namespace core {
@@ -19,8 +20,8 @@ struct TranslationEntry {
     
     TranslationEntry() = default;
     
-    TranslationEntry(const std::string& id, const std::string& str, const std::string& cmt = "")
-        : msgid(id), msgstr(str), comment(cmt) {}
+    TranslationEntry(std::string id, std::string str, std::string cmt = "")
+        : msgid(std::move(id)), msgstr(std::move(str)), comment(std::move(cmt)) {}
 };
 
 } // namespace core
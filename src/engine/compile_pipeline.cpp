@@ -0,0 +1,148 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "compile_pipeline.h"
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../core/spsc_queue.h"
+
+namespace fs = std::filesystem;
+
+namespace gettextify {
+namespace engine {
+
+namespace {
+
+// Thrown inside the producer to unwind it once the consumer has given up
+struct Cancelled {};
+
+/**
+ * Sink that hands entries over to the consumer thread
+ */
+class QueueSink : public core::EntrySink {
+public:
+    explicit QueueSink(core::SpscQueue<core::TranslationEntry>& queue) : queue_(queue) {}
+
+    void add_entry(core::TranslationEntry&& entry) override {
+        if (!queue_.push(std::move(entry))) {
+            throw Cancelled();
+        }
+    }
+
+private:
+    core::SpscQueue<core::TranslationEntry>& queue_;
+};
+
+/**
+ * Cancels and joins the producer if the consumer unwinds while it runs
+ */
+class ProducerGuard {
+public:
+    ProducerGuard(std::thread& thread, core::SpscQueue<core::TranslationEntry>& queue)
+        : thread_(thread), queue_(queue) {}
+
+    ProducerGuard(const ProducerGuard&) = delete;
+    ProducerGuard& operator=(const ProducerGuard&) = delete;
+
+    ~ProducerGuard() {
+        if (thread_.joinable()) {
+            queue_.cancel();
+            thread_.join();
+        }
+    }
+
+private:
+    std::thread& thread_;
+    core::SpscQueue<core::TranslationEntry>& queue_;
+};
+
+// Fails before the input is consumed rather than after a long parse
+void check_output_path(const std::string& output_path) {
+    fs::path path(output_path);
+    if (fs::is_directory(path)) {
+        throw std::runtime_error("Output path is a directory: " + output_path);
+    }
+    if (path.has_parent_path() && !fs::is_directory(path.parent_path())) {
+        throw std::runtime_error("Output directory does not exist: " +
+                                 path.parent_path().string());
+    }
+}
+
+} // namespace
+
+CompilePipeline::CompilePipeline(MoCompiler& compiler, size_t queue_capacity, size_t run_size)
+    : compiler_(compiler)
+    , queue_capacity_(queue_capacity)
+    , run_size_(run_size < 1 ? 1 : run_size) {}
+
+size_t CompilePipeline::run(const Producer& producer, const std::string& output_path) {
+    core::SpscQueue<core::TranslationEntry> queue(queue_capacity_);
+    std::exception_ptr error;
+
+    std::thread producer_thread([&]() {
+        try {
+            QueueSink sink(queue);
+            producer(sink);
+        } catch (const Cancelled&) {
+            // The consumer is already unwinding with its own exception
+        } catch (...) {
+            error = std::current_exception();
+        }
+        queue.close();
+    });
+    ProducerGuard guard(producer_thread, queue);
+
+    check_output_path(output_path);
+
+    // Sort fixed-size runs while the producer keeps parsing
+    std::vector<core::TranslationEntry> entries;
+    std::vector<size_t> run_bounds{0};
+    core::TranslationEntry entry;
+
+    while (queue.pop(entry)) {
+        entries.push_back(std::move(entry));
+        if (entries.size() - run_bounds.back() == run_size_) {
+            std::stable_sort(entries.begin() + run_bounds.back(), entries.end(),
+                             MoCompiler::msgid_less);
+            run_bounds.push_back(entries.size());
+        }
+    }
+    producer_thread.join();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    if (run_bounds.back() != entries.size()) {
+        std::stable_sort(entries.begin() + run_bounds.back(), entries.end(),
+                         MoCompiler::msgid_less);
+        run_bounds.push_back(entries.size());
+    }
+
+    // Merge adjacent runs pairwise until one sorted range remains
+    while (run_bounds.size() > 2) {
+        std::vector<size_t> merged{0};
+        for (size_t i = 0; i + 2 < run_bounds.size(); i += 2) {
+            std::inplace_merge(entries.begin() + run_bounds[i],
+                               entries.begin() + run_bounds[i + 1],
+                               entries.begin() + run_bounds[i + 2],
+                               MoCompiler::msgid_less);
+            merged.push_back(run_bounds[i + 2]);
+        }
+        if (run_bounds.size() % 2 == 0) {
+            merged.push_back(run_bounds.back());
+        }
+        run_bounds = std::move(merged);
+    }
+
+    compiler_.compile_sorted(entries, output_path);
+    return entries.size();
+}
+
+} // namespace engine
+} // namespace gettextify
@@ -0,0 +1,51 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_ENGINE_COMPILE_PIPELINE_H
+#define GETTEXTIFY_ENGINE_COMPILE_PIPELINE_H
+
+#include <string>
+#include <functional>
+#include <cstddef>
+#include "../core/entry_sink.h"
+#include "mo_compiler.h"
+#include "../core/export.h"
+
+namespace gettextify {
+namespace engine {
+
+/**
+ * Overlaps parsing with sorting for MO compilation
+ *
+ * The producer runs on its own thread and pushes entries into a bounded
+ * lock-free queue. The calling thread collects them into runs, sorting each
+ * run as soon as it is full, then merges the runs and writes the MO file.
+ */
+class GETTEXTIFY_API CompilePipeline {
+public:
+    using Producer = std::function<void(core::EntrySink&)>;
+
+    explicit CompilePipeline(MoCompiler& compiler,
+                             size_t queue_capacity = 4096,
+                             size_t run_size = 65536);
+
+    /**
+     * Compiles everything the producer emits into output_path
+     *
+     * Exceptions thrown by the producer are rethrown here and no output
+     * file is written. If the output directory does not exist the producer
+     * is cancelled and the error is thrown before any sorting happens.
+     * Returns the number of entries compiled.
+     */
+    size_t run(const Producer& producer, const std::string& output_path);
+
+private:
+    MoCompiler& compiler_;
+    size_t queue_capacity_;
+    size_t run_size_;
+};
+
+} // namespace engine
+} // namespace gettextify
+
+#endif // GETTEXTIFY_ENGINE_COMPILE_PIPELINE_H
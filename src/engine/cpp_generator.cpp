@@ -0,0 +1,360 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "cpp_generator.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace gettextify {
+namespace engine {
+
+namespace {
+
+bool is_identifier(const std::string& name) {
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) {
+        return false;
+    }
+    return std::all_of(name.begin(), name.end(), [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+    });
+}
+
+// Accepts nested namespaces written as a::b
+bool is_namespace(const std::string& name_space) {
+    size_t start = 0;
+    while (true) {
+        size_t end = name_space.find("::", start);
+        if (!is_identifier(name_space.substr(start, end - start))) {
+            return false;
+        }
+        if (end == std::string::npos) {
+            return true;
+        }
+        start = end + 2;
+    }
+}
+
+// Namespace and header file name together, so two tables generated into one
+// namespace can still be included side by side
+std::string include_guard(const std::string& name_space, const std::string& header_name) {
+    std::string guard = "GETTEXTIFY_GENERATED_";
+    for (size_t i = 0; i < name_space.size(); ++i) {
+        if (name_space[i] == ':') {
+            guard += '_';
+            ++i;
+        } else {
+            guard += static_cast<char>(std::toupper(static_cast<unsigned char>(name_space[i])));
+        }
+    }
+    guard += '_';
+    for (char ch : header_name) {
+        auto c = static_cast<unsigned char>(ch);
+        guard += std::isalnum(c) ? static_cast<char>(std::toupper(c)) : '_';
+    }
+    return guard;
+}
+
+// Writes a string literal, escaping everything outside printable ASCII as
+// three-digit octal so a following digit can never extend the escape. '?'
+// is escaped too, so sequences like "??=" never form trigraphs.
+void write_literal(std::ostream& out, std::string_view str) {
+    static const char digits[] = "01234567";
+    out << '"';
+    for (char ch : str) {
+        auto c = static_cast<unsigned char>(ch);
+        if (c == '"' || c == '\\' || c == '?') {
+            out << '\\' << ch;
+        } else if (c >= 0x20 && c < 0x7f) {
+            out << ch;
+        } else {
+            out << '\\' << digits[c >> 6] << digits[(c >> 3) & 7] << digits[c & 7];
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+uint32_t PerfectHash::slot(std::string_view key, uint32_t key_count) const {
+    int32_t d = displacements[CppGenerator::hash(key, 0) % displacements.size()];
+    if (d < 0) {
+        return static_cast<uint32_t>(-d - 1);
+    }
+    return CppGenerator::hash(key, static_cast<uint32_t>(d)) % key_count;
+}
+
+CppGenerator::CppGenerator(const std::string& name_space) {
+    set_namespace(name_space);
+}
+
+void CppGenerator::set_namespace(const std::string& name_space) {
+    if (!is_namespace(name_space)) {
+        throw std::runtime_error("Invalid C++ namespace: " + name_space);
+    }
+    name_space_ = name_space;
+}
+
+const std::string& CppGenerator::get_namespace() const {
+    return name_space_;
+}
+
+uint32_t CppGenerator::hash(std::string_view key, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (char c : key) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+PerfectHash CppGenerator::build_perfect_hash(const std::vector<std::string_view>& keys) {
+    PerfectHash result;
+    if (keys.empty()) {
+        return result;
+    }
+    if (keys.size() > static_cast<size_t>(INT32_MAX)) {
+        throw std::runtime_error("Too many keys for a perfect hash");
+    }
+    
+    auto key_count = static_cast<uint32_t>(keys.size());
+    uint32_t bucket_count = (key_count + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET;
+    std::vector<std::vector<uint32_t>> buckets(bucket_count);
+    for (uint32_t i = 0; i < key_count; ++i) {
+        buckets[hash(keys[i], 0) % bucket_count].push_back(i);
+    }
+    
+    // Place the largest buckets first, while most slots are still free
+    std::vector<uint32_t> order(bucket_count);
+    for (uint32_t b = 0; b < bucket_count; ++b) {
+        order[b] = b;
+    }
+    std::stable_sort(order.begin(), order.end(), [&buckets](uint32_t a, uint32_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+    
+    result.displacements.assign(bucket_count, 0);
+    std::vector<bool> taken(key_count, false);
+    std::vector<uint32_t> slots;
+    
+    size_t next = 0;
+    for (; next < order.size() && buckets[order[next]].size() > 1; ++next) {
+        const auto& bucket = buckets[order[next]];
+        
+        // Equal keys would never separate, whatever the seed
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            for (size_t j = i + 1; j < bucket.size(); ++j) {
+                if (keys[bucket[i]] == keys[bucket[j]]) {
+                    throw std::runtime_error("Duplicate key in perfect hash: " +
+                                             std::string(keys[bucket[i]]));
+                }
+            }
+        }
+        
+        uint32_t seed = 1;
+        for (; seed < MAX_SEED; ++seed) {
+            slots.clear();
+            for (uint32_t index : bucket) {
+                uint32_t slot = hash(keys[index], seed) % key_count;
+                if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                    break;
+                }
+                slots.push_back(slot);
+            }
+            if (slots.size() == bucket.size()) {
+                break;
+            }
+        }
+        if (seed == MAX_SEED) {
+            throw std::runtime_error("Cannot build perfect hash: no seed found");
+        }
+        
+        for (uint32_t slot : slots) {
+            taken[slot] = true;
+        }
+        result.displacements[order[next]] = static_cast<int32_t>(seed);
+    }
+    
+    // Single-key buckets take the remaining slots directly
+    uint32_t free_slot = 0;
+    for (; next < order.size() && buckets[order[next]].size() == 1; ++next) {
+        while (taken[free_slot]) {
+            ++free_slot;
+        }
+        taken[free_slot] = true;
+        result.displacements[order[next]] = -static_cast<int32_t>(free_slot) - 1;
+    }
+    
+    return result;
+}
+
+void CppGenerator::generate(const core::Catalog& catalog, const std::string& header_path,
+                            const std::string& source_path) const {
+    std::ofstream header(header_path, std::ios::binary);
+    if (!header) {
+        throw std::runtime_error("Cannot create output file: " + header_path);
+    }
+    std::ofstream source(source_path, std::ios::binary);
+    if (!source) {
+        throw std::runtime_error("Cannot create output file: " + source_path);
+    }
+    
+    generate(catalog, header, source, std::filesystem::path(header_path).filename().string());
+    
+    header.close();
+    source.close();
+    if (!header) {
+        throw std::runtime_error("Cannot write output file: " + header_path);
+    }
+    if (!source) {
+        throw std::runtime_error("Cannot write output file: " + source_path);
+    }
+}
+
+void CppGenerator::generate(const core::Catalog& catalog, std::ostream& header,
+                            std::ostream& source, const std::string& header_name) const {
+    // Only translated entries are embedded; the last duplicate msgid wins
+    std::vector<const core::TranslationEntry*> entries;
+    std::unordered_map<std::string_view, size_t> positions;
+    for (const auto& entry : catalog.get_entries()) {
+        if (entry.msgid.empty() || entry.msgstr.empty()) {
+            continue;
+        }
+        auto inserted = positions.emplace(entry.msgid, entries.size());
+        if (inserted.second) {
+            entries.push_back(&entry);
+        } else {
+            entries[inserted.first->second] = &entry;
+        }
+    }
+    
+    std::vector<std::string_view> keys;
+    keys.reserve(entries.size());
+    for (const auto* entry : entries) {
+        keys.push_back(entry->msgid);
+    }
+    PerfectHash perfect_hash = build_perfect_hash(keys);
+    
+    // Lay the entries out in slot order
+    auto key_count = static_cast<uint32_t>(entries.size());
+    std::vector<const core::TranslationEntry*> slots(entries.size());
+    for (const auto* entry : entries) {
+        slots[perfect_hash.slot(entry->msgid, key_count)] = entry;
+    }
+    
+    std::string guard = include_guard(name_space_, header_name);
+    header << "// Generated by gettextify. Do not edit.\n\n"
+           << "#ifndef " << guard << "\n"
+           << "#define " << guard << "\n\n"
+           << "#include <cstddef>\n"
+           << "#include <string_view>\n\n"
+           << "namespace " << name_space_ << " {\n\n"
+           << "constexpr std::size_t entry_count = " << key_count << ";\n\n"
+           << "/**\n"
+           << " * Returns the translation of msgid, or an empty view if there is none\n"
+           << " */\n"
+           << "std::string_view lookup(std::string_view msgid) noexcept;\n\n"
+           << "/**\n"
+           << " * Returns the translation of msgid, falling back to msgid itself\n"
+           << " */\n"
+           << "inline std::string_view translate(std::string_view msgid) noexcept {\n"
+           << "    std::string_view msgstr = lookup(msgid);\n"
+           << "    return msgstr.empty() ? msgid : msgstr;\n"
+           << "}\n\n"
+           << "} // namespace " << name_space_ << "\n\n"
+           << "#endif // " << guard << "\n";
+    
+    source << "// Generated by gettextify. Do not edit.\n\n"
+           << "#include \"" << header_name << "\"\n"
+           << "#include <cstdint>\n\n"
+           << "namespace " << name_space_ << " {\n\n";
+    
+    if (entries.empty()) {
+        source << "std::string_view lookup(std::string_view) noexcept {\n"
+               << "    return {};\n"
+               << "}\n\n"
+               << "} // namespace " << name_space_ << "\n";
+        return;
+    }
+    
+    source << "namespace {\n\n"
+           << "struct Entry {\n"
+           << "    std::uint32_t msgid_offset;\n"
+           << "    std::uint32_t msgid_length;\n"
+           << "    std::uint32_t msgstr_offset;\n"
+           << "    std::uint32_t msgstr_length;\n"
+           << "};\n\n"
+           << "constexpr char strings[] =\n";
+    
+    uint64_t offset = 0;
+    for (const auto* entry : slots) {
+        for (const std::string* str : {&entry->msgid, &entry->msgstr}) {
+            source << "    ";
+            write_literal(source, *str);
+            source << "\n";
+            offset += str->size();
+        }
+    }
+    if (offset > UINT32_MAX) {
+        throw std::runtime_error("Catalog is too large for generated C++ tables");
+    }
+    source << "    ;\n\n"
+           << "constexpr Entry entries[" << key_count << "] = {\n";
+    
+    offset = 0;
+    for (const auto* entry : slots) {
+        source << "    {" << offset << ", " << entry->msgid.size() << ", "
+               << offset + entry->msgid.size() << ", " << entry->msgstr.size() << "},\n";
+        offset += entry->msgid.size() + entry->msgstr.size();
+    }
+    
+    source << "};\n\n"
+           << "constexpr std::int32_t displacements[" << perfect_hash.displacements.size()
+           << "] = {\n";
+    for (size_t i = 0; i < perfect_hash.displacements.size(); ++i) {
+        source << (i % 8 == 0 ? "    " : " ") << perfect_hash.displacements[i] << ",";
+        if (i % 8 == 7 || i + 1 == perfect_hash.displacements.size()) {
+            source << "\n";
+        }
+    }
+    
+    source << "};\n\n"
+           << "constexpr std::uint32_t hash(std::string_view key, std::uint32_t seed) noexcept {\n"
+           << "    std::uint32_t h = 2166136261u ^ seed;\n"
+           << "    for (char c : key) {\n"
+           << "        h ^= static_cast<unsigned char>(c);\n"
+           << "        h *= 16777619u;\n"
+           << "    }\n"
+           << "    h ^= h >> 16;\n"
+           << "    h *= 0x85ebca6bu;\n"
+           << "    h ^= h >> 13;\n"
+           << "    h *= 0xc2b2ae35u;\n"
+           << "    h ^= h >> 16;\n"
+           << "    return h;\n"
+           << "}\n\n"
+           << "} // namespace\n\n"
+           << "std::string_view lookup(std::string_view msgid) noexcept {\n"
+           << "    std::int32_t d = displacements[hash(msgid, 0) % "
+           << perfect_hash.displacements.size() << "];\n"
+           << "    std::uint32_t slot = d < 0 ? static_cast<std::uint32_t>(-d - 1)\n"
+           << "                               : hash(msgid, static_cast<std::uint32_t>(d)) % "
+           << key_count << ";\n"
+           << "    const Entry& entry = entries[slot];\n"
+           << "    if (msgid != std::string_view(strings + entry.msgid_offset, entry.msgid_length)) {\n"
+           << "        return {};\n"
+           << "    }\n"
+           << "    return std::string_view(strings + entry.msgstr_offset, entry.msgstr_length);\n"
+           << "}\n\n"
+           << "} // namespace " << name_space_ << "\n";
+}
+
+} // namespace engine
+} // namespace gettextify
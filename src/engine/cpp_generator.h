@@ -0,0 +1,76 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_ENGINE_CPP_GENERATOR_H
+#define GETTEXTIFY_ENGINE_CPP_GENERATOR_H
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "../core/catalog.h"
+#include "../core/export.h"
+
+namespace gettextify {
+namespace engine {
+
+/**
+ * Minimal perfect hash over a fixed key set (hash, displace and compress)
+ *
+ * Keys are grouped into buckets by hash(key, 0). A bucket with several keys
+ * stores a seed d such that hash(key, d) % key_count places all of them on
+ * free slots; a bucket with a single key stores -(slot + 1) directly.
+ */
+struct GETTEXTIFY_API PerfectHash {
+    std::vector<int32_t> displacements;
+    
+    uint32_t slot(std::string_view key, uint32_t key_count) const;
+};
+
+/**
+ * Generator for C++17 sources that embed a catalog as constexpr tables
+ *
+ * The header declares lookup() in the chosen namespace; the source holds the
+ * string data, the slot table and the displacement table of a minimal perfect
+ * hash computed at generation time. A lookup is one hash, one table read and
+ * one string compare, with no parsing or initialization at run time.
+ */
+class GETTEXTIFY_API CppGenerator {
+public:
+    explicit CppGenerator(const std::string& name_space = "translations");
+    
+    /**
+     * Writes the header and the source; the source includes the header by
+     * its file name
+     */
+    void generate(const core::Catalog& catalog, const std::string& header_path,
+                  const std::string& source_path) const;
+    void generate(const core::Catalog& catalog, std::ostream& header, std::ostream& source,
+                  const std::string& header_name) const;
+    
+    /**
+     * 32-bit FNV-1a with a murmur3 finalizer; emitted verbatim into the
+     * generated source
+     */
+    static uint32_t hash(std::string_view key, uint32_t seed);
+    
+    /**
+     * Builds a minimal perfect hash for distinct keys
+     */
+    static PerfectHash build_perfect_hash(const std::vector<std::string_view>& keys);
+    
+    void set_namespace(const std::string& name_space);
+    const std::string& get_namespace() const;
+    
+private:
+    static constexpr uint32_t KEYS_PER_BUCKET = 4;
+    static constexpr uint32_t MAX_SEED = 1u << 24;
+    
+    std::string name_space_;
+};
+
+} // namespace engine
+} // namespace gettextify
+
+#endif // GETTEXTIFY_ENGINE_CPP_GENERATOR_H
@@ -4,8 +4,8 @@
 #include "mo_compiler.h"
 #include <fstream>
 #include <algorithm>
+#include <cstring>
 #include <ctime>
-#include <iomanip>
 #include <sstream>
 #include <stdexcept>
 
@@ -22,8 +22,17 @@ const core::Metadata& MoCompiler::get_metadata() const {
 
 std::string MoCompiler::create_header_entry() const {
     std::time_t now = std::time(nullptr);
+    std::tm local_time{};
+    
+    // std::localtime shares one static buffer; compilers may run on many threads
+#ifdef _WIN32
+    localtime_s(&local_time, &now);
+#else
+    localtime_r(&now, &local_time);
+#endif
+    
     char time_buf[32];
-    std::strftime(time_buf, sizeof(time_buf), "%Y-%m-%d %H:%M%z", std::localtime(&now));
+    std::strftime(time_buf, sizeof(time_buf), "%Y-%m-%d %H:%M%z", &local_time);
     
     std::ostringstream header;
     header << "Project-Id-Version: " << metadata_.project_id_version << "\n"
@@ -44,60 +53,110 @@ std::string MoCompiler::create_header_entry() const {
     return header.str();
 }
 
-std::string MoCompiler::bytes_key(const std::string& str) const {
-    std::ostringstream oss;
-    for (unsigned char c : str) {
-        oss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(c);
-    }
-    return oss.str();
+bool MoCompiler::msgid_less(const core::TranslationEntry& a, const core::TranslationEntry& b) {
+    // std::string compares bytes as unsigned char, which is the MO lookup order
+    return a.msgid < b.msgid;
 }
 
-core::Catalog MoCompiler::prepare_catalog(const core::Catalog& catalog) const {
-    core::Catalog result;
-    
-    // Copy entries
-    for (const auto& entry : catalog.get_entries()) {
-        result.add_entry(entry);
-    }
-    
+void MoCompiler::sort_entries(std::vector<core::TranslationEntry>& entries) {
+    std::stable_sort(entries.begin(), entries.end(), msgid_less);
+}
+
+void MoCompiler::compile(const core::Catalog& catalog, const std::string& output_path) {
+    auto buffer = compile_to_buffer(catalog);
+    write_file(buffer, output_path);
+}
+
+void MoCompiler::compile_sorted(const std::vector<core::TranslationEntry>& entries,
+                                const std::string& output_path) {
+    auto buffer = compile_sorted_to_buffer(entries);
+    write_file(buffer, output_path);
+}
+
+void MoCompiler::compile_sorted(const std::vector<std::string_view>& msgids,
+                                const std::vector<std::string_view>& msgstrs,
+                                const std::string& output_path) {
+    auto buffer = compile_sorted_to_buffer(msgids, msgstrs);
+    write_file(buffer, output_path);
+}
+
+std::vector<std::byte> MoCompiler::compile_to_buffer(const core::Catalog& catalog) const {
     // Sort by msgid bytes for binary search compatibility
-    auto& entries = result.get_entries();
-    std::sort(entries.begin(), entries.end(), 
-        [this](const core::TranslationEntry& a, const core::TranslationEntry& b) {
-            if (a.msgid.empty()) return true;
-            if (b.msgid.empty()) return false;
-            return bytes_key(a.msgid) < bytes_key(b.msgid);
-        });
+    std::vector<core::TranslationEntry> entries = catalog.get_entries();
+    sort_entries(entries);
     
-    // Add header entry if not present
-    if (result.empty() || !result.get_entries()[0].msgid.empty()) {
-        core::Catalog temp;
-        temp.add_entry("", create_header_entry());
-        for (const auto& entry : result.get_entries()) {
-            temp.add_entry(entry);
-        }
-        result = temp;
+    return compile_sorted_to_buffer(entries);
+}
+
+std::vector<std::byte> MoCompiler::compile_sorted_to_buffer(
+    const std::vector<core::TranslationEntry>& entries) const {
+    std::vector<std::string_view> msgids;
+    std::vector<std::string_view> msgstrs;
+    msgids.reserve(entries.size());
+    msgstrs.reserve(entries.size());
+    for (const auto& entry : entries) {
+        msgids.push_back(entry.msgid);
+        msgstrs.push_back(entry.msgstr);
     }
     
-    return result;
+    return compile_sorted_to_buffer(msgids, msgstrs);
 }
 
-void MoCompiler::compile(const core::Catalog& catalog, const std::string& output_path) {
-    auto prepared = prepare_catalog(catalog);
-    const auto& entries = prepared.get_entries();
+std::vector<std::byte> MoCompiler::compile_sorted_to_buffer(
+    const std::vector<std::string_view>& msgids,
+    const std::vector<std::string_view>& msgstrs) const {
+    if (msgids.size() != msgstrs.size()) {
+        throw std::runtime_error("Mismatched msgid and msgstr counts");
+    }
     
-    std::ofstream file(output_path, std::ios::binary);
-    if (!file) {
-        throw std::runtime_error("Cannot create output file: " + output_path);
+    // Untranslated entries are left out as msgfmt does; gettext would
+    // otherwise return an empty string for them instead of the msgid
+    auto untranslated = [&](size_t i) { return msgstrs[i].empty() && !msgids[i].empty(); };
+    size_t skipped = 0;
+    for (size_t i = 0; i < msgids.size(); ++i) {
+        skipped += untranslated(i);
+    }
+    if (skipped > 0) {
+        std::vector<std::string_view> kept_msgids;
+        std::vector<std::string_view> kept_msgstrs;
+        kept_msgids.reserve(msgids.size() - skipped);
+        kept_msgstrs.reserve(msgids.size() - skipped);
+        for (size_t i = 0; i < msgids.size(); ++i) {
+            if (!untranslated(i)) {
+                kept_msgids.push_back(msgids[i]);
+                kept_msgstrs.push_back(msgstrs[i]);
+            }
+        }
+        return compile_sorted_to_buffer(kept_msgids, kept_msgstrs);
     }
     
-    uint32_t num_strings = entries.size();
-    uint32_t strings_offset = MO_HEADER_SIZE;
-    uint32_t string_table_offset = strings_offset + num_strings * 8 * 2;
+    // Add header entry if not present
+    bool has_header = !msgids.empty() && msgids[0].empty();
+    std::string header = has_header ? std::string() : create_header_entry();
+    static const std::string_view empty;
+    
+    uint64_t num_strings = msgids.size() + (has_header ? 0 : 1);
+    uint64_t strings_offset = MO_HEADER_SIZE;
+    uint64_t string_table_offset = strings_offset + num_strings * 8 * 2;
+    
+    // Size the image up front so it is filled without reallocation
+    uint64_t total_size = string_table_offset;
+    if (!has_header) total_size += empty.length() + 1 + header.length() + 1;
+    for (size_t i = 0; i < msgids.size(); ++i) {
+        total_size += msgids[i].length() + 1 + msgstrs[i].length() + 1;
+    }
+    if (total_size > UINT32_MAX) {
+        throw std::runtime_error("Catalog is too large for the MO format");
+    }
+    
+    std::vector<std::byte> buffer(total_size);
+    std::byte* out = buffer.data();
     
     // Write header
-    auto write_u32 = [&file](uint32_t value) {
-        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    auto write_u32 = [&out](uint64_t value) {
+        uint32_t v = static_cast<uint32_t>(value);
+        std::memcpy(out, &v, sizeof(v));
+        out += sizeof(v);
     };
     
     write_u32(MO_MAGIC);
@@ -108,41 +167,58 @@ void MoCompiler::compile(const core::Catalog& catalog, const std::string& output
     write_u32(0);
     write_u32(string_table_offset);
     
-    // Prepare string data
-    std::vector<std::string> original_strings;
-    std::vector<std::string> translated_strings;
-    
-    for (const auto& entry : entries) {
-        original_strings.push_back(entry.msgid);
-        translated_strings.push_back(entry.msgstr);
-    }
-    
     // Write original strings table
-    uint32_t current_offset = string_table_offset;
-    for (const auto& str : original_strings) {
+    uint64_t current_offset = string_table_offset;
+    auto write_descriptor = [&](std::string_view str) {
         write_u32(str.length());
         write_u32(current_offset);
         current_offset += str.length() + 1;
+    };
+    
+    if (!has_header) write_descriptor(empty);
+    for (auto str : msgids) {
+        write_descriptor(str);
     }
     
     // Write translated strings table
-    for (const auto& str : translated_strings) {
-        write_u32(str.length());
-        write_u32(current_offset);
-        current_offset += str.length() + 1;
+    if (!has_header) write_descriptor(header);
+    for (auto str : msgstrs) {
+        write_descriptor(str);
     }
     
+    // Strings are NUL-terminated; the buffer is zero-initialized
+    auto write_string = [&out](std::string_view str) {
+        std::memcpy(out, str.data(), str.length());
+        out += str.length() + 1;
+    };
+    
     // Write original strings data
-    for (const auto& str : original_strings) {
-        file.write(str.c_str(), str.length() + 1);
+    if (!has_header) write_string(empty);
+    for (auto str : msgids) {
+        write_string(str);
     }
     
     // Write translated strings data
-    for (const auto& str : translated_strings) {
-        file.write(str.c_str(), str.length() + 1);
+    if (!has_header) write_string(header);
+    for (auto str : msgstrs) {
+        write_string(str);
     }
     
+    return buffer;
+}
+
+void MoCompiler::write_file(const std::vector<std::byte>& buffer, const std::string& output_path) {
+    std::ofstream file(output_path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot create output file: " + output_path);
+    }
+    
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
     file.close();
+    
+    if (!file) {
+        throw std::runtime_error("Cannot write output file: " + output_path);
+    }
 }
 
 } // namespace engine
@@ -6,22 +6,52 @@
 
 #include <string>
 #include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <vector>
 #include "../core/catalog.h"
 #include "../core/metadata.h"
+#include "../core/export.h"
 
 namespace gettextify {
 namespace engine {
 
 /**
  * Compiler for MO (Machine Object) binary gettext files
+ *
+ * Entries with an empty msgstr are untranslated and are not written.
  */
-class MoCompiler {
+class GETTEXTIFY_API MoCompiler {
 public:
     MoCompiler() = default;
     explicit MoCompiler(const core::Metadata& metadata) : metadata_(metadata) {}
     
     void compile(const core::Catalog& catalog, const std::string& output_path);
     
+    /**
+     * Writes entries that are already in MO order (see sort_entries)
+     *
+     * A header entry is generated unless the first msgid is empty.
+     */
+    void compile_sorted(const std::vector<core::TranslationEntry>& entries,
+                        const std::string& output_path);
+    void compile_sorted(const std::vector<std::string_view>& msgids,
+                        const std::vector<std::string_view>& msgstrs,
+                        const std::string& output_path);
+    
+    /**
+     * Builds the MO image in memory instead of writing a file
+     */
+    std::vector<std::byte> compile_to_buffer(const core::Catalog& catalog) const;
+    std::vector<std::byte> compile_sorted_to_buffer(
+        const std::vector<core::TranslationEntry>& entries) const;
+    std::vector<std::byte> compile_sorted_to_buffer(
+        const std::vector<std::string_view>& msgids,
+        const std::vector<std::string_view>& msgstrs) const;
+    
+    static bool msgid_less(const core::TranslationEntry& a, const core::TranslationEntry& b);
+    static void sort_entries(std::vector<core::TranslationEntry>& entries);
+    
     void set_metadata(const core::Metadata& metadata);
     const core::Metadata& get_metadata() const;
     
@@ -31,8 +61,7 @@ private:
     static constexpr int MO_HEADER_SIZE = 28;
     
     std::string create_header_entry() const;
-    core::Catalog prepare_catalog(const core::Catalog& catalog) const;
-    std::string bytes_key(const std::string& str) const;
+    static void write_file(const std::vector<std::byte>& buffer, const std::string& output_path);
     
     core::Metadata metadata_;
 };
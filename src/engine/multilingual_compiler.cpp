@@ -0,0 +1,110 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "multilingual_compiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include "mo_compiler.h"
+
+namespace gettextify {
+namespace engine {
+
+MultilingualCompiler::MultilingualCompiler(const core::Metadata& metadata, unsigned threads)
+    : metadata_(metadata), threads_(threads) {}
+
+std::string MultilingualCompiler::expand_path(const std::string& output_template,
+                                              const std::string& language) {
+    // Column names come from the input file, so keep them inside the template
+    if (language.empty() || language == "." || language == ".." ||
+        language.find_first_of("/\\") != std::string::npos) {
+        throw std::runtime_error("Invalid language name for output path: '" + language + "'");
+    }
+    
+    size_t placeholder_length = std::strlen(LANGUAGE_PLACEHOLDER);
+    size_t pos = output_template.find(LANGUAGE_PLACEHOLDER);
+    if (pos == std::string::npos) {
+        throw std::runtime_error(std::string("Output path must contain ") + LANGUAGE_PLACEHOLDER);
+    }
+    
+    std::string path = output_template;
+    while (pos != std::string::npos) {
+        path.replace(pos, placeholder_length, language);
+        pos = path.find(LANGUAGE_PLACEHOLDER, pos + language.size());
+    }
+    return path;
+}
+
+std::vector<size_t> MultilingualCompiler::compile(const core::MultilingualCatalog& catalog,
+                                                  const std::vector<std::string>& output_paths) const {
+    const auto& languages = catalog.get_languages();
+    if (output_paths.size() != languages.size()) {
+        throw std::runtime_error("Expected one output path per language");
+    }
+    
+    // Sort once; every language shares the same msgid order
+    std::vector<size_t> order(catalog.size());
+    for (size_t row = 0; row < order.size(); ++row) {
+        order[row] = row;
+    }
+    std::stable_sort(order.begin(), order.end(), [&catalog](size_t a, size_t b) {
+        return catalog.msgid(a) < catalog.msgid(b);
+    });
+    
+    std::vector<size_t> counts(languages.size(), 0);
+    std::vector<std::exception_ptr> errors(languages.size());
+    std::atomic<size_t> next{0};
+    
+    auto worker = [&]() {
+        size_t language;
+        while ((language = next.fetch_add(1)) < languages.size()) {
+            try {
+                std::vector<std::string_view> msgids;
+                std::vector<std::string_view> msgstrs;
+                msgids.reserve(order.size());
+                msgstrs.reserve(order.size());
+                for (size_t row : order) {
+                    const std::string& msgstr = catalog.msgstr(row, language);
+                    if (!msgstr.empty()) {
+                        msgids.push_back(catalog.msgid(row));
+                        msgstrs.push_back(msgstr);
+                    }
+                }
+                
+                core::Metadata metadata = metadata_;
+                metadata.language = languages[language];
+                MoCompiler compiler(metadata);
+                compiler.compile_sorted(msgids, msgstrs, output_paths[language]);
+                counts[language] = msgids.size();
+            } catch (...) {
+                errors[language] = std::current_exception();
+            }
+        }
+    };
+    
+    unsigned threads = threads_ != 0 ? threads_ : std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<size_t>(threads, languages.size()));
+    
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < threads; ++i) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return counts;
+}
+
+} // namespace engine
+} // namespace gettextify
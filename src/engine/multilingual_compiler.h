@@ -0,0 +1,56 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_ENGINE_MULTILINGUAL_COMPILER_H
+#define GETTEXTIFY_ENGINE_MULTILINGUAL_COMPILER_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "../core/metadata.h"
+#include "../core/multilingual_catalog.h"
+#include "../core/export.h"
+
+namespace gettextify {
+namespace engine {
+
+/**
+ * Writes one MO file per language of a multilingual catalog
+ *
+ * The msgid order is computed once and shared by every language; the
+ * per-language images are then built and written concurrently.
+ */
+class GETTEXTIFY_API MultilingualCompiler {
+public:
+    static constexpr const char* LANGUAGE_PLACEHOLDER = "{lang}";
+    
+    /**
+     * threads == 0 uses one thread per hardware core
+     */
+    explicit MultilingualCompiler(const core::Metadata& metadata = core::Metadata(),
+                                  unsigned threads = 0);
+    
+    /**
+     * Compiles language i into output_paths[i], with the Language header
+     * set to its column name. Empty translations are left out, as
+     * MoCompiler does for single catalogs.
+     *
+     * Returns the number of entries written for each language.
+     */
+    std::vector<size_t> compile(const core::MultilingualCatalog& catalog,
+                                const std::vector<std::string>& output_paths) const;
+    
+    /**
+     * Replaces every {lang} in output_template with language
+     */
+    static std::string expand_path(const std::string& output_template, const std::string& language);
+    
+private:
+    core::Metadata metadata_;
+    unsigned threads_;
+};
+
+} // namespace engine
+} // namespace gettextify
+
+#endif // GETTEXTIFY_ENGINE_MULTILINGUAL_COMPILER_H
@@ -2,16 +2,64 @@
 // This code licensed under LGPL 3.0
 
 #include "csv_parser.h"
-#include <fstream>
-#include <sstream>
 #include <stdexcept>
 #include <iostream>
 #include <algorithm>
+#include <utility>
+#include "../input_stream.h"
 
 namespace gettextify {
 namespace format {
 namespace csv {
 
+namespace {
+
+void trim(std::string& value) {
+    value.erase(0, value.find_first_not_of(" \t\r\n"));
+    value.erase(value.find_last_not_of(" \t\r\n") + 1);
+}
+
+bool is_lower(char c) {
+    return c >= 'a' && c <= 'z';
+}
+
+bool is_alnum(char c) {
+    return is_lower(c) || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+// Locale names such as de, pt_BR, zh-Hant or sr@latin: a two or three
+// letter language code, optional subtags and an optional modifier
+bool is_locale_name(const std::string& name) {
+    size_t i = 0;
+    while (i < name.size() && is_lower(name[i])) {
+        ++i;
+    }
+    if (i < 2 || i > 3) {
+        return false;
+    }
+    while (i < name.size() && (name[i] == '_' || name[i] == '-')) {
+        size_t start = ++i;
+        while (i < name.size() && is_alnum(name[i])) {
+            ++i;
+        }
+        if (i - start < 2 || i - start > 8) {
+            return false;
+        }
+    }
+    if (i < name.size() && name[i] == '@') {
+        size_t start = ++i;
+        while (i < name.size() && is_alnum(name[i])) {
+            ++i;
+        }
+        if (i == start) {
+            return false;
+        }
+    }
+    return i == name.size();
+}
+
+} // namespace
+
 CsvParser::CsvParser(char delimiter) : delimiter_(delimiter) {}
 
 void CsvParser::set_delimiter(char delimiter) {
@@ -22,6 +70,45 @@ char CsvParser::get_delimiter() const {
     return delimiter_;
 }
 
+void CsvParser::set_background_decompression(bool enabled) {
+    background_decompression_ = enabled;
+}
+
+bool CsvParser::get_background_decompression() const {
+    return background_decompression_;
+}
+
+void CsvParser::set_keep_comments(bool enabled) {
+    keep_comments_ = enabled;
+}
+
+bool CsvParser::get_keep_comments() const {
+    return keep_comments_;
+}
+
+bool CsvParser::read_record(InputStream& file, std::string& record, int& line_num) const {
+    if (!file.getline(record)) {
+        return false;
+    }
+    ++line_num;
+    
+    // Escaped quotes come in pairs, so an odd count leaves a field open
+    int first_line = line_num;
+    size_t quotes = std::count(record.begin(), record.end(), '"');
+    std::string next;
+    while (quotes % 2 != 0) {
+        if (!file.getline(next)) {
+            throw std::runtime_error("Unterminated quoted field starting at line " +
+                                     std::to_string(first_line));
+        }
+        ++line_num;
+        quotes += std::count(next.begin(), next.end(), '"');
+        record += '\n';
+        record += next;
+    }
+    return true;
+}
+
 std::vector<std::string> CsvParser::split_line(const std::string& line) const {
     std::vector<std::string> fields;
     bool in_quotes = false;
@@ -54,21 +141,66 @@ std::vector<std::string> CsvParser::split_line(const std::string& line) const {
     return fields;
 }
 
-std::string CsvParser::remove_quotes(const std::string& value) const {
-    if (value.length() >= 2 && value.front() == '"' && value.back() == '"') {
-        return value.substr(1, value.length() - 2);
+size_t CsvParser::split_projected(const std::string& line, const std::vector<int>& slots,
+                                  std::vector<std::string>& fields) const {
+    for (auto& field : fields) {
+        field.clear();
+    }
+    
+    size_t column = 0;
+    size_t i = 0;
+    size_t length = line.length();
+    while (true) {
+        int slot = column < slots.size() ? slots[column] : -1;
+        std::string* field = slot >= 0 ? &fields[slot] : nullptr;
+        bool in_quotes = false;
+        
+        while (i < length) {
+            char c = line[i];
+            if (c == '"') {
+                if (in_quotes && i + 1 < length && line[i + 1] == '"') {
+                    // Escaped quote
+                    if (field) *field += '"';
+                    i += 2;
+                } else {
+                    // Toggle quote mode
+                    in_quotes = !in_quotes;
+                    ++i;
+                }
+            } else if (c == delimiter_ && !in_quotes) {
+                break;
+            } else {
+                // Copy the run up to the next quote or delimiter in one go
+                size_t end = i + 1;
+                while (end < length && line[end] != '"' && (in_quotes || line[end] != delimiter_)) {
+                    ++end;
+                }
+                if (field) field->append(line, i, end - i);
+                i = end;
+            }
+        }
+        
+        ++column;
+        if (i >= length) {
+            return column;
+        }
+        ++i;  // Skip the delimiter
     }
-    return value;
 }
 
-void CsvParser::parse(const std::string& file_path, core::Catalog& catalog) {
-    std::ifstream file(file_path);
-    if (!file) {
-        throw std::runtime_error("Cannot open file: " + file_path);
+void CsvParser::remove_quotes(std::string& value) const {
+    if (value.length() >= 2 && value.front() == '"' && value.back() == '"') {
+        value.pop_back();
+        value.erase(0, 1);
     }
+}
+
+void CsvParser::parse(const std::string& file_path, core::EntrySink& sink) {
+    InputStream file(file_path, background_decompression_);
     
     std::string line;
-    if (!std::getline(file, line)) {
+    int line_num = 0;
+    if (!read_record(file, line, line_num)) {
         throw std::runtime_error("CSV file is empty");
     }
     
@@ -80,9 +212,7 @@ void CsvParser::parse(const std::string& file_path, core::Catalog& catalog) {
     
     for (size_t i = 0; i < header.size(); ++i) {
         std::string col = header[i];
-        // Trim whitespace
-        col.erase(0, col.find_first_not_of(" \t\r\n"));
-        col.erase(col.find_last_not_of(" \t\r\n") + 1);
+        trim(col);
         
         if (col == "msgid") msgid_idx = i;
         else if (col == "msgstr") msgstr_idx = i;
@@ -93,38 +223,141 @@ void CsvParser::parse(const std::string& file_path, core::Catalog& catalog) {
         throw std::runtime_error("CSV must have 'msgid' and 'msgstr' columns");
     }
     
+    // Only the needed columns are copied out of each row
+    enum { MSGID, MSGSTR, COMMENT };
+    std::vector<int> slots(header.size(), -1);
+    slots[msgid_idx] = MSGID;
+    slots[msgstr_idx] = MSGSTR;
+    if (keep_comments_ && comment_idx >= 0) {
+        slots[comment_idx] = COMMENT;
+    }
+    std::vector<std::string> fields(3);
+    
+    // Rows must reach the comment column even when it is not kept
+    int max_idx = std::max({msgid_idx, msgstr_idx, comment_idx});
+    
     // Parse data rows
-    int line_num = 1;
-    while (std::getline(file, line)) {
-        ++line_num;
-        
+    while (read_record(file, line, line_num)) {
         // Skip empty lines
         if (line.empty() || line.find_first_not_of(" \t\r\n") == std::string::npos) {
             continue;
         }
         
-        auto fields = split_line(line);
-        
-        int max_idx = std::max({msgid_idx, msgstr_idx, comment_idx});
-        if (static_cast<int>(fields.size()) <= max_idx) {
-            std::cerr << "Warning: Skipping line " << line_num 
+        size_t count = split_projected(line, slots, fields);
+        if (static_cast<int>(count) <= max_idx) {
+            // Report the first line of a record that spans several
+            int row_start = line_num - static_cast<int>(std::count(line.begin(), line.end(), '\n'));
+            std::cerr << "Warning: Skipping line " << row_start 
                       << " due to insufficient fields" << std::endl;
             continue;
         }
         
-        std::string msgid = remove_quotes(fields[msgid_idx]);
-        std::string msgstr = remove_quotes(fields[msgstr_idx]);
-        std::string comment = (comment_idx >= 0 && comment_idx < static_cast<int>(fields.size())) 
-                              ? remove_quotes(fields[comment_idx]) : "";
+        for (auto& field : fields) {
+            remove_quotes(field);
+        }
+        trim(fields[MSGID]);
+        trim(fields[MSGSTR]);
         
-        // Trim whitespace
-        msgid.erase(0, msgid.find_first_not_of(" \t\r\n"));
-        msgid.erase(msgid.find_last_not_of(" \t\r\n") + 1);
-        msgstr.erase(0, msgstr.find_first_not_of(" \t\r\n"));
-        msgstr.erase(msgstr.find_last_not_of(" \t\r\n") + 1);
+        sink.add_entry(core::TranslationEntry(std::move(fields[MSGID]), std::move(fields[MSGSTR]),
+                                              std::move(fields[COMMENT])));
+    }
+}
+
+core::MultilingualCatalog CsvParser::parse_multilingual(const std::string& file_path,
+                                                       const std::vector<std::string>& languages) {
+    InputStream file(file_path, background_decompression_);
+    
+    std::string line;
+    int line_num = 0;
+    if (!read_record(file, line, line_num)) {
+        throw std::runtime_error("CSV file is empty");
+    }
+    
+    // Parse header
+    auto header = split_line(line);
+    int msgid_idx = -1;
+    for (size_t i = 0; i < header.size(); ++i) {
+        trim(header[i]);
+        if (header[i] == "msgid") msgid_idx = i;
+    }
+    if (msgid_idx == -1) {
+        throw std::runtime_error("CSV must have a 'msgid' column");
+    }
+    
+    // Slot 0 is the msgid, slot i + 1 the i-th language; the comment and
+    // any unselected columns are never copied
+    std::vector<std::string> names;
+    std::vector<int> slots(header.size(), -1);
+    slots[msgid_idx] = 0;
+    
+    // Each language becomes its own output file, so names must be unique
+    auto select = [&](size_t column) {
+        if (slots[column] >= 0 ||
+            std::find(names.begin(), names.end(), header[column]) != names.end()) {
+            throw std::runtime_error("CSV column '" + header[column] + "' is selected more than once");
+        }
+        names.push_back(header[column]);
+        slots[column] = static_cast<int>(names.size());
+    };
+    
+    if (languages.empty()) {
+        // Guessing would turn columns such as context or notes into languages
+        for (size_t i = 0; i < header.size(); ++i) {
+            if (header[i] == "msgid" || header[i] == "msgstr" || header[i] == "comment" ||
+                header[i].empty()) {
+                continue;
+            }
+            if (!is_locale_name(header[i])) {
+                throw std::runtime_error("CSV column '" + header[i] +
+                                         "' is not a language code; list the language "
+                                         "columns explicitly (--languages)");
+            }
+            select(i);
+        }
+    } else {
+        for (const auto& language : languages) {
+            auto it = std::find(header.begin(), header.end(), language);
+            if (it == header.end()) {
+                throw std::runtime_error("CSV has no column for language '" + language + "'");
+            }
+            select(it - header.begin());
+        }
+    }
+    if (names.empty()) {
+        throw std::runtime_error("CSV has no language columns");
+    }
+    
+    core::MultilingualCatalog catalog(names);
+    
+    // Parse data rows
+    while (read_record(file, line, line_num)) {
+        // Skip empty lines
+        if (line.empty() || line.find_first_not_of(" \t\r\n") == std::string::npos) {
+            continue;
+        }
         
-        catalog.add_entry(msgid, msgstr, comment);
+        std::vector<std::string> fields(names.size() + 1);
+        size_t count = split_projected(line, slots, fields);
+        if (static_cast<int>(count) <= msgid_idx) {
+            // Report the first line of a record that spans several
+            int row_start = line_num - static_cast<int>(std::count(line.begin(), line.end(), '\n'));
+            std::cerr << "Warning: Skipping line " << row_start
+                      << " due to insufficient fields" << std::endl;
+            continue;
+        }
+        
+        // Missing trailing cells stay empty
+        for (auto& field : fields) {
+            remove_quotes(field);
+            trim(field);
+        }
+        
+        std::string msgid = std::move(fields[0]);
+        fields.erase(fields.begin());
+        catalog.add_row(std::move(msgid), std::move(fields));
     }
+    
+    return catalog;
 }
 
 } // namespace csv
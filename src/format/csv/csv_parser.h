@@ -5,29 +5,74 @@
 #define GETTEXTIFY_FORMAT_CSV_PARSER_H
 
 #include <string>
-#include "../../core/catalog.h"
+#include <vector>
+#include "../parser.h"
+#include "../../core/multilingual_catalog.h"
+#include "../../core/export.h"
 
 namespace gettextify {
 namespace format {
+
+class InputStream;
+
 namespace csv {
 
 /**
  * Parser for CSV files containing translation data
+ *
+ * Quoted fields may span several lines. gzip and zstd compressed files are
+ * decompressed on the fly.
  */
-class CsvParser {
+class GETTEXTIFY_API CsvParser : public Parser {
 public:
     explicit CsvParser(char delimiter = ',');
     
-    void parse(const std::string& file_path, core::Catalog& catalog);
+    void parse(const std::string& file_path, core::EntrySink& sink) override;
+    
+    /**
+     * Reads a table with a msgid column and one column per language
+     *
+     * Every column other than msgid, msgstr and comment is a language unless
+     * languages names the ones to keep. Without a list, a column whose name
+     * is not a locale code (de, pt_BR, sr@latin) is an error, so files with
+     * extra columns such as context or notes need an explicit list. Missing
+     * trailing cells are empty.
+     */
+    core::MultilingualCatalog parse_multilingual(const std::string& file_path,
+                                                 const std::vector<std::string>& languages = {});
     
     void set_delimiter(char delimiter);
     char get_delimiter() const;
     
+    // Decompress on a separate thread so decoding overlaps with parsing
+    void set_background_decompression(bool enabled);
+    bool get_background_decompression() const;
+    
+    // When disabled, the comment column is skipped and entries carry none
+    void set_keep_comments(bool enabled);
+    bool get_keep_comments() const;
+    
 private:
     char delimiter_;
+    bool background_decompression_ = false;
+    bool keep_comments_ = true;
+    
+    /**
+     * Reads one record, joining physical lines while a quoted field is open.
+     * line_num is advanced past every line consumed.
+     */
+    bool read_record(InputStream& file, std::string& record, int& line_num) const;
     
     std::vector<std::string> split_line(const std::string& line) const;
-    std::string remove_quotes(const std::string& value) const;
+    
+    /**
+     * Splits only the projected columns: fields[slots[i]] receives column i
+     * when slots[i] >= 0. Other fields are scanned past without copying.
+     * Returns the number of fields on the line.
+     */
+    size_t split_projected(const std::string& line, const std::vector<int>& slots,
+                           std::vector<std::string>& fields) const;
+    void remove_quotes(std::string& value) const;
 };
 
 } // namespace csv
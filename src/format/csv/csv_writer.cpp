@@ -0,0 +1,64 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "csv_writer.h"
+#include <fstream>
+#include <stdexcept>
+
+namespace gettextify {
+namespace format {
+namespace csv {
+
+CsvWriter::CsvWriter(char delimiter) : delimiter_(delimiter) {}
+
+void CsvWriter::set_delimiter(char delimiter) {
+    delimiter_ = delimiter;
+}
+
+char CsvWriter::get_delimiter() const {
+    return delimiter_;
+}
+
+void CsvWriter::write_field(std::ostream& out, const std::string& value) const {
+    out << '"';
+    size_t start = 0;
+    size_t quote;
+    while ((quote = value.find('"', start)) != std::string::npos) {
+        out.write(value.data() + start, quote - start + 1);
+        out << '"';
+        start = quote + 1;
+    }
+    out.write(value.data() + start, value.size() - start);
+    out << '"';
+}
+
+void CsvWriter::write(const std::vector<core::TranslationEntry>& entries, std::ostream& out) {
+    out << "msgid" << delimiter_ << "msgstr" << delimiter_ << "comment\n";
+    
+    for (const auto& entry : entries) {
+        write_field(out, entry.msgid);
+        out << delimiter_;
+        write_field(out, entry.msgstr);
+        out << delimiter_;
+        write_field(out, entry.comment);
+        out << '\n';
+    }
+}
+
+void CsvWriter::write(const std::vector<core::TranslationEntry>& entries,
+                      const std::string& file_path) {
+    std::ofstream file(file_path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot create output file: " + file_path);
+    }
+    
+    write(entries, file);
+    
+    if (!file) {
+        throw std::runtime_error("Cannot write output file: " + file_path);
+    }
+}
+
+} // namespace csv
+} // namespace format
+} // namespace gettextify
@@ -0,0 +1,42 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_FORMAT_CSV_WRITER_H
+#define GETTEXTIFY_FORMAT_CSV_WRITER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "../../core/translation_entry.h"
+#include "../../core/export.h"
+
+namespace gettextify {
+namespace format {
+namespace csv {
+
+/**
+ * Writer for CSV files readable by CsvParser
+ *
+ * Every field is quoted, with embedded quotes doubled.
+ */
+class GETTEXTIFY_API CsvWriter {
+public:
+    explicit CsvWriter(char delimiter = ',');
+    
+    void write(const std::vector<core::TranslationEntry>& entries, const std::string& file_path);
+    void write(const std::vector<core::TranslationEntry>& entries, std::ostream& out);
+    
+    void set_delimiter(char delimiter);
+    char get_delimiter() const;
+    
+private:
+    char delimiter_;
+    
+    void write_field(std::ostream& out, const std::string& value) const;
+};
+
+} // namespace csv
+} // namespace format
+} // namespace gettextify
+
+#endif // GETTEXTIFY_FORMAT_CSV_WRITER_H
@@ -0,0 +1,335 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "input_stream.h"
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "../core/spsc_queue.h"
+
+#ifdef GETTEXTIFY_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef GETTEXTIFY_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace gettextify {
+namespace format {
+
+namespace {
+
+constexpr size_t BACKGROUND_QUEUE_CHUNKS = 4;
+
+/**
+ * Source of decoded data blocks
+ */
+class Decoder {
+public:
+    virtual ~Decoder() = default;
+
+    // Replaces chunk with the next decoded block; false at end of input
+    virtual bool next(std::string& chunk) = 0;
+};
+
+std::ifstream open_file(const std::string& file_path) {
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open file: " + file_path);
+    }
+    return file;
+}
+
+class PlainDecoder : public Decoder {
+public:
+    PlainDecoder(const std::string& file_path, size_t chunk_size)
+        : file_(open_file(file_path)), chunk_size_(chunk_size) {}
+
+    bool next(std::string& chunk) override {
+        chunk.resize(chunk_size_);
+        file_.read(&chunk[0], chunk_size_);
+        chunk.resize(static_cast<size_t>(file_.gcount()));
+        return !chunk.empty();
+    }
+
+private:
+    std::ifstream file_;
+    size_t chunk_size_;
+};
+
+#ifdef GETTEXTIFY_HAVE_ZLIB
+class GzipDecoder : public Decoder {
+public:
+    GzipDecoder(const std::string& file_path, size_t chunk_size)
+        : file_(open_file(file_path)), file_path_(file_path)
+        , input_(chunk_size), chunk_size_(chunk_size) {
+        std::memset(&stream_, 0, sizeof(stream_));
+        // 16 + MAX_WBITS selects gzip framing
+        if (inflateInit2(&stream_, 16 + MAX_WBITS) != Z_OK) {
+            throw std::runtime_error("Cannot initialize gzip decoder");
+        }
+    }
+
+    ~GzipDecoder() override {
+        inflateEnd(&stream_);
+    }
+
+    bool next(std::string& chunk) override {
+        chunk.resize(chunk_size_);
+        stream_.next_out = reinterpret_cast<Bytef*>(&chunk[0]);
+        stream_.avail_out = static_cast<uInt>(chunk_size_);
+
+        while (stream_.avail_out > 0 && !done_) {
+            if (stream_.avail_in == 0 && !flush_pending_) {
+                file_.read(input_.data(), input_.size());
+                size_t n = static_cast<size_t>(file_.gcount());
+                if (n == 0) {
+                    if (member_open_) {
+                        throw std::runtime_error("Truncated gzip input: " + file_path_);
+                    }
+                    done_ = true;
+                    break;
+                }
+                stream_.next_in = reinterpret_cast<Bytef*>(input_.data());
+                stream_.avail_in = static_cast<uInt>(n);
+            }
+
+            if (stream_.avail_in > 0) {
+                member_open_ = true;
+            }
+            int ret = inflate(&stream_, Z_NO_FLUSH);
+            flush_pending_ = (stream_.avail_out == 0);
+
+            if (ret == Z_STREAM_END) {
+                // Concatenated gzip members decode as one stream
+                member_open_ = false;
+                flush_pending_ = false;
+                inflateReset(&stream_);
+            } else if (ret == Z_BUF_ERROR) {
+                flush_pending_ = false;
+            } else if (ret != Z_OK) {
+                throw std::runtime_error("Corrupted gzip input: " + file_path_);
+            }
+        }
+
+        chunk.resize(chunk_size_ - stream_.avail_out);
+        return !chunk.empty();
+    }
+
+private:
+    std::ifstream file_;
+    std::string file_path_;
+    std::vector<char> input_;
+    size_t chunk_size_;
+    z_stream stream_;
+    bool member_open_ = false;
+    bool flush_pending_ = false;
+    bool done_ = false;
+};
+#endif
+
+#ifdef GETTEXTIFY_HAVE_ZSTD
+class ZstdDecoder : public Decoder {
+public:
+    ZstdDecoder(const std::string& file_path, size_t chunk_size)
+        : file_(open_file(file_path)), file_path_(file_path)
+        , input_(chunk_size), chunk_size_(chunk_size), context_(ZSTD_createDCtx()) {
+        if (context_ == nullptr) {
+            throw std::runtime_error("Cannot initialize zstd decoder");
+        }
+    }
+
+    ~ZstdDecoder() override {
+        ZSTD_freeDCtx(context_);
+    }
+
+    bool next(std::string& chunk) override {
+        chunk.resize(chunk_size_);
+        ZSTD_outBuffer out = { &chunk[0], chunk_size_, 0 };
+
+        while (out.pos < out.size && !done_) {
+            if (in_.pos == in_.size && !flush_pending_) {
+                file_.read(input_.data(), input_.size());
+                size_t n = static_cast<size_t>(file_.gcount());
+                if (n == 0) {
+                    if (frame_open_) {
+                        throw std::runtime_error("Truncated zstd input: " + file_path_);
+                    }
+                    done_ = true;
+                    break;
+                }
+                in_ = { input_.data(), n, 0 };
+            }
+
+            size_t consumed_before = in_.pos;
+            size_t ret = ZSTD_decompressStream(context_, &out, &in_);
+            if (ZSTD_isError(ret)) {
+                throw std::runtime_error("Corrupted zstd input: " + file_path_ + " (" +
+                                         ZSTD_getErrorName(ret) + ")");
+            }
+
+            // A zero return means the current frame is fully decoded and flushed
+            if (ret == 0) {
+                frame_open_ = false;
+                flush_pending_ = false;
+            } else {
+                if (in_.pos > consumed_before) {
+                    frame_open_ = true;
+                }
+                flush_pending_ = (out.pos == out.size);
+            }
+        }
+
+        chunk.resize(out.pos);
+        return !chunk.empty();
+    }
+
+private:
+    std::ifstream file_;
+    std::string file_path_;
+    std::vector<char> input_;
+    size_t chunk_size_;
+    ZSTD_DCtx* context_;
+    ZSTD_inBuffer in_ = { nullptr, 0, 0 };
+    bool frame_open_ = false;
+    bool flush_pending_ = false;
+    bool done_ = false;
+};
+#endif
+
+std::unique_ptr<Decoder> make_decoder(const std::string& file_path, Compression compression,
+                                      size_t chunk_size) {
+    switch (compression) {
+        case Compression::GZIP:
+#ifdef GETTEXTIFY_HAVE_ZLIB
+            return std::make_unique<GzipDecoder>(file_path, chunk_size);
+#else
+            throw std::runtime_error("gzip input is not supported by this build: " + file_path);
+#endif
+        case Compression::ZSTD:
+#ifdef GETTEXTIFY_HAVE_ZSTD
+            return std::make_unique<ZstdDecoder>(file_path, chunk_size);
+#else
+            throw std::runtime_error("zstd input is not supported by this build: " + file_path);
+#endif
+        case Compression::NONE:
+            break;
+    }
+    return std::make_unique<PlainDecoder>(file_path, chunk_size);
+}
+
+} // namespace
+
+struct InputStream::Impl {
+    std::unique_ptr<Decoder> decoder;
+
+    // Background decoding state
+    std::unique_ptr<core::SpscQueue<std::string>> queue;
+    std::thread thread;
+    std::exception_ptr error;
+
+    ~Impl() {
+        if (thread.joinable()) {
+            queue->cancel();
+            thread.join();
+        }
+    }
+
+    void start_background() {
+        queue = std::make_unique<core::SpscQueue<std::string>>(BACKGROUND_QUEUE_CHUNKS);
+        thread = std::thread([this]() {
+            try {
+                // push() fails once the reader has been destroyed
+                std::string chunk;
+                while (decoder->next(chunk) && queue->push(std::move(chunk))) {
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+            queue->close();
+        });
+    }
+
+    bool next(std::string& chunk) {
+        if (!queue) {
+            return decoder->next(chunk);
+        }
+        if (queue->pop(chunk)) {
+            return true;
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return false;
+    }
+};
+
+Compression detect_compression(const std::string& file_path) {
+    std::ifstream file = open_file(file_path);
+
+    unsigned char magic[4] = {0, 0, 0, 0};
+    file.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    size_t n = static_cast<size_t>(file.gcount());
+
+    if (n >= 2 && magic[0] == 0x1f && magic[1] == 0x8b) {
+        return Compression::GZIP;
+    }
+    if (n >= 4 && magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd) {
+        return Compression::ZSTD;
+    }
+    return Compression::NONE;
+}
+
+InputStream::InputStream(const std::string& file_path, bool background, size_t chunk_size)
+    : compression_(detect_compression(file_path))
+    , impl_(std::make_unique<Impl>()) {
+    impl_->decoder = make_decoder(file_path, compression_, chunk_size < 1 ? 1 : chunk_size);
+    if (background) {
+        impl_->start_background();
+    }
+}
+
+InputStream::~InputStream() = default;
+
+bool InputStream::read_chunk(std::string& chunk) {
+    // Hand out data already buffered by getline first
+    if (buffer_pos_ < buffer_.size()) {
+        chunk.assign(buffer_, buffer_pos_, std::string::npos);
+        buffer_.clear();
+        buffer_pos_ = 0;
+        return true;
+    }
+    return impl_->next(chunk);
+}
+
+bool InputStream::getline(std::string& line) {
+    line.clear();
+    while (true) {
+        const char* begin = buffer_.data() + buffer_pos_;
+        size_t remaining = buffer_.size() - buffer_pos_;
+        const char* newline = static_cast<const char*>(std::memchr(begin, '\n', remaining));
+        if (newline != nullptr) {
+            line.append(begin, newline);
+            buffer_pos_ += (newline - begin) + 1;
+            return true;
+        }
+
+        line.append(begin, remaining);
+        buffer_pos_ = 0;
+        if (!impl_->next(buffer_)) {
+            buffer_.clear();
+            return !line.empty();
+        }
+    }
+}
+
+Compression InputStream::compression() const {
+    return compression_;
+}
+
+} // namespace format
+} // namespace gettextify
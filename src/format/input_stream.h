@@ -0,0 +1,65 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_FORMAT_INPUT_STREAM_H
+#define GETTEXTIFY_FORMAT_INPUT_STREAM_H
+
+#include <string>
+#include <cstddef>
+#include <memory>
+#include "../core/export.h"
+
+namespace gettextify {
+namespace format {
+
+enum class Compression {
+    NONE,
+    GZIP,
+    ZSTD
+};
+
+/**
+ * Detects gzip or zstd input by its magic bytes
+ */
+GETTEXTIFY_API Compression detect_compression(const std::string& file_path);
+
+/**
+ * Chunked file reader with transparent gzip/zstd decompression
+ *
+ * Compressed input is decoded in chunks as it is consumed, so it never has
+ * to be written to disk. With background decompression enabled, reading
+ * and decoding run on a separate thread ahead of the consumer.
+ */
+class GETTEXTIFY_API InputStream {
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 256 * 1024;
+
+    explicit InputStream(const std::string& file_path,
+                         bool background = false,
+                         size_t chunk_size = DEFAULT_CHUNK_SIZE);
+    ~InputStream();
+
+    InputStream(const InputStream&) = delete;
+    InputStream& operator=(const InputStream&) = delete;
+
+    // Replaces chunk with the next block of decoded data; false at end of input
+    bool read_chunk(std::string& chunk);
+
+    // Reads up to the next '\n' (not included); false at end of input
+    bool getline(std::string& line);
+
+    Compression compression() const;
+
+private:
+    struct Impl;
+
+    Compression compression_;
+    std::unique_ptr<Impl> impl_;
+    std::string buffer_;
+    size_t buffer_pos_ = 0;
+};
+
+} // namespace format
+} // namespace gettextify
+
+#endif // GETTEXTIFY_FORMAT_INPUT_STREAM_H
@@ -0,0 +1,390 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "json_parser.h"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <iostream>
+#include "../../core/mapped_file.h"
+#include "../input_stream.h"
+
+namespace gettextify {
+namespace format {
+namespace json {
+
+namespace {
+
+constexpr int MAX_DEPTH = 512;
+
+/**
+ * Single-pass tokenizer that emits string leaves straight into a sink
+ */
+class Reader {
+public:
+    Reader(const char* data, size_t size, const std::string& separator, core::EntrySink& sink)
+        : begin_(data), pos_(data), end_(data + size), separator_(separator), sink_(sink) {}
+
+    void run() {
+        // Skip UTF-8 byte order mark
+        if (end_ - pos_ >= 3 && std::memcmp(pos_, "\xEF\xBB\xBF", 3) == 0) {
+            pos_ += 3;
+        }
+
+        skip_whitespace();
+        if (pos_ == end_) {
+            throw std::runtime_error("JSON file is empty");
+        }
+        if (*pos_ != '{') {
+            fail("expected object at top level");
+        }
+        parse_object(0);
+
+        skip_whitespace();
+        if (pos_ != end_) {
+            fail("unexpected data after top-level object");
+        }
+    }
+
+private:
+    const char* begin_;
+    const char* pos_;
+    const char* end_;
+    const std::string& separator_;
+    core::EntrySink& sink_;
+    std::string key_;
+    std::string value_;
+
+    [[noreturn]] void fail(const std::string& message) const {
+        size_t line = 1;
+        const char* line_start = begin_;
+        for (const char* p = begin_; p < pos_; ++p) {
+            if (*p == '\n') {
+                ++line;
+                line_start = p + 1;
+            }
+        }
+        throw std::runtime_error("JSON parse error at line " + std::to_string(line) +
+                                 ", column " + std::to_string(pos_ - line_start + 1) +
+                                 ": " + message);
+    }
+
+    void skip_whitespace() {
+        while (pos_ < end_ && (*pos_ == ' ' || *pos_ == '\n' || *pos_ == '\r' || *pos_ == '\t')) {
+            ++pos_;
+        }
+    }
+
+    void expect(char c) {
+        skip_whitespace();
+        if (pos_ == end_ || *pos_ != c) {
+            fail(std::string("expected '") + c + "'");
+        }
+        ++pos_;
+    }
+
+    // Parses the object at pos_; key_ holds the flattened prefix of its members
+    void parse_object(int depth) {
+        if (depth > MAX_DEPTH) {
+            fail("nesting too deep");
+        }
+        expect('{');
+
+        skip_whitespace();
+        if (pos_ < end_ && *pos_ == '}') {
+            ++pos_;
+            return;
+        }
+
+        size_t prefix_len = key_.size();
+        while (true) {
+            skip_whitespace();
+            if (pos_ == end_ || *pos_ != '"') {
+                fail("expected string key");
+            }
+            // Members of the root object have no prefix, even an empty one
+            if (depth > 0) {
+                key_ += separator_;
+            }
+            read_string(key_);
+
+            expect(':');
+            skip_whitespace();
+            if (pos_ == end_) {
+                fail("unexpected end of input");
+            }
+
+            if (*pos_ == '"') {
+                value_.clear();
+                read_string(value_);
+                sink_.add_entry(core::TranslationEntry(key_, value_));
+            } else if (*pos_ == '{') {
+                parse_object(depth + 1);
+            } else {
+                skip_value(depth + 1);
+                std::cerr << "Warning: Skipping non-string value for key '" << key_ << "'"
+                          << std::endl;
+            }
+            key_.resize(prefix_len);
+
+            skip_whitespace();
+            if (pos_ == end_) {
+                fail("unexpected end of input");
+            }
+            if (*pos_ == ',') {
+                ++pos_;
+            } else if (*pos_ == '}') {
+                ++pos_;
+                return;
+            } else {
+                fail("expected ',' or '}'");
+            }
+        }
+    }
+
+    // Appends the decoded string at pos_ (which points at the opening quote) to out
+    void read_string(std::string& out) {
+        ++pos_;
+        while (true) {
+            const char* quote = static_cast<const char*>(std::memchr(pos_, '"', end_ - pos_));
+            if (quote == nullptr) {
+                pos_ = end_;
+                fail("unterminated string");
+            }
+
+            const char* backslash =
+                static_cast<const char*>(std::memchr(pos_, '\\', quote - pos_));
+            if (backslash == nullptr) {
+                // Fast path: no escapes before the closing quote
+                out.append(pos_, quote);
+                pos_ = quote + 1;
+                return;
+            }
+
+            out.append(pos_, backslash);
+            pos_ = backslash + 1;
+            read_escape(out);
+        }
+    }
+
+    void read_escape(std::string& out) {
+        if (pos_ == end_) {
+            fail("unterminated escape sequence");
+        }
+        char c = *pos_++;
+        switch (c) {
+            case '"':  out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/':  out += '/'; break;
+            case 'b':  out += '\b'; break;
+            case 'f':  out += '\f'; break;
+            case 'n':  out += '\n'; break;
+            case 'r':  out += '\r'; break;
+            case 't':  out += '\t'; break;
+            case 'u': {
+                uint32_t code = read_hex4();
+                if (code == 0) {
+                    // gettext looks strings up as C strings, which would end here
+                    pos_ -= 6;
+                    fail("U+0000 is not allowed in strings");
+                }
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    // High surrogate must be followed by a low surrogate
+                    if (end_ - pos_ < 2 || pos_[0] != '\\' || pos_[1] != 'u') {
+                        fail("invalid surrogate pair");
+                    }
+                    pos_ += 2;
+                    uint32_t low = read_hex4();
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        fail("invalid surrogate pair");
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                } else if (code >= 0xDC00 && code <= 0xDFFF) {
+                    fail("invalid surrogate pair");
+                }
+                append_utf8(out, code);
+                break;
+            }
+            default:
+                --pos_;
+                fail("invalid escape sequence");
+        }
+    }
+
+    uint32_t read_hex4() {
+        if (end_ - pos_ < 4) {
+            fail("truncated unicode escape");
+        }
+        uint32_t code = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = *pos_++;
+            code <<= 4;
+            if (c >= '0' && c <= '9') code |= c - '0';
+            else if (c >= 'a' && c <= 'f') code |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') code |= c - 'A' + 10;
+            else fail("invalid unicode escape");
+        }
+        return code;
+    }
+
+    static void append_utf8(std::string& out, uint32_t code) {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        } else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    // Skips over any value without emitting entries
+    void skip_value(int depth) {
+        if (depth > MAX_DEPTH) {
+            fail("nesting too deep");
+        }
+        skip_whitespace();
+        if (pos_ == end_) {
+            fail("unexpected end of input");
+        }
+
+        char c = *pos_;
+        if (c == '"') {
+            value_.clear();
+            read_string(value_);
+        } else if (c == '{' || c == '[') {
+            char close = (c == '{') ? '}' : ']';
+            ++pos_;
+            skip_whitespace();
+            if (pos_ < end_ && *pos_ == close) {
+                ++pos_;
+                return;
+            }
+            while (true) {
+                if (c == '{') {
+                    skip_whitespace();
+                    if (pos_ == end_ || *pos_ != '"') {
+                        fail("expected string key");
+                    }
+                    value_.clear();
+                    read_string(value_);
+                    expect(':');
+                }
+                skip_value(depth + 1);
+                skip_whitespace();
+                if (pos_ < end_ && *pos_ == ',') {
+                    ++pos_;
+                } else if (pos_ < end_ && *pos_ == close) {
+                    ++pos_;
+                    return;
+                } else {
+                    fail(std::string("expected ',' or '") + close + "'");
+                }
+            }
+        } else if (c == 't') {
+            skip_literal("true");
+        } else if (c == 'f') {
+            skip_literal("false");
+        } else if (c == 'n') {
+            skip_literal("null");
+        } else if (c == '-' || is_digit(c)) {
+            skip_number();
+        } else {
+            fail("unexpected character");
+        }
+    }
+
+    static bool is_digit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    void skip_literal(const char* literal) {
+        size_t length = std::strlen(literal);
+        if (static_cast<size_t>(end_ - pos_) < length || std::memcmp(pos_, literal, length) != 0) {
+            fail(std::string("invalid literal, expected '") + literal + "'");
+        }
+        pos_ += length;
+    }
+
+    // number = [ "-" ] int [ frac ] [ exp ], as in RFC 8259
+    void skip_number() {
+        if (*pos_ == '-') {
+            ++pos_;
+        }
+        if (pos_ == end_ || !is_digit(*pos_)) {
+            fail("invalid number");
+        }
+        if (*pos_ == '0') {
+            ++pos_;
+        } else {
+            skip_digits();
+        }
+        if (pos_ < end_ && *pos_ == '.') {
+            ++pos_;
+            if (pos_ == end_ || !is_digit(*pos_)) {
+                fail("invalid number: expected digit after '.'");
+            }
+            skip_digits();
+        }
+        if (pos_ < end_ && (*pos_ == 'e' || *pos_ == 'E')) {
+            ++pos_;
+            if (pos_ < end_ && (*pos_ == '+' || *pos_ == '-')) {
+                ++pos_;
+            }
+            if (pos_ == end_ || !is_digit(*pos_)) {
+                fail("invalid number: expected digit in exponent");
+            }
+            skip_digits();
+        }
+    }
+
+    void skip_digits() {
+        while (pos_ < end_ && is_digit(*pos_)) {
+            ++pos_;
+        }
+    }
+};
+
+} // namespace
+
+JsonParser::JsonParser(const std::string& separator) : separator_(separator) {}
+
+void JsonParser::set_separator(const std::string& separator) {
+    separator_ = separator;
+}
+
+const std::string& JsonParser::get_separator() const {
+    return separator_;
+}
+
+void JsonParser::parse_buffer(const char* data, size_t size, core::EntrySink& sink) {
+    Reader reader(data, size, separator_, sink);
+    reader.run();
+}
+
+void JsonParser::parse(const std::string& file_path, core::EntrySink& sink) {
+    if (detect_compression(file_path) != Compression::NONE) {
+        InputStream input(file_path);
+        std::string data;
+        std::string chunk;
+        while (input.read_chunk(chunk)) {
+            data += chunk;
+        }
+        parse_buffer(data.data(), data.size(), sink);
+        return;
+    }
+
+    core::MappedFile file(file_path);
+    parse_buffer(file.data(), file.size(), sink);
+}
+
+} // namespace json
+} // namespace format
+} // namespace gettextify
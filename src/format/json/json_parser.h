@@ -0,0 +1,44 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_FORMAT_JSON_PARSER_H
+#define GETTEXTIFY_FORMAT_JSON_PARSER_H
+
+#include <string>
+#include <cstddef>
+#include "../parser.h"
+#include "../../core/export.h"
+
+namespace gettextify {
+namespace format {
+namespace json {
+
+/**
+ * Streaming parser for JSON translation maps
+ *
+ * The root object maps msgids to translated strings. Nested objects are
+ * flattened into msgids by joining the keys with the separator, so
+ * {"menu": {"file": "Файл"}} yields the entry "menu.file" -> "Файл".
+ * The input is tokenized in a single pass without building a DOM.
+ * Plain files are memory-mapped; gzip and zstd files are decompressed
+ * into memory first.
+ */
+class GETTEXTIFY_API JsonParser : public Parser {
+public:
+    explicit JsonParser(const std::string& separator = ".");
+
+    void parse(const std::string& file_path, core::EntrySink& sink) override;
+    void parse_buffer(const char* data, size_t size, core::EntrySink& sink);
+
+    void set_separator(const std::string& separator);
+    const std::string& get_separator() const;
+
+private:
+    std::string separator_;
+};
+
+} // namespace json
+} // namespace format
+} // namespace gettextify
+
+#endif // GETTEXTIFY_FORMAT_JSON_PARSER_H
@@ -0,0 +1,89 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "mo_parser.h"
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include "../input_stream.h"
+#include "../../core/mapped_file.h"
+
+namespace gettextify {
+namespace format {
+namespace mo {
+
+void MoParser::parse(const std::string& file_path, core::EntrySink& sink) {
+    std::string decoded;
+    std::unique_ptr<core::MappedFile> file;
+    const char* data;
+    size_t size;
+    if (detect_compression(file_path) != Compression::NONE) {
+        // Offsets point anywhere in the file, so compressed input is decoded whole
+        InputStream input(file_path);
+        std::string chunk;
+        while (input.read_chunk(chunk)) {
+            decoded += chunk;
+        }
+        data = decoded.data();
+        size = decoded.size();
+    } else {
+        file = std::make_unique<core::MappedFile>(file_path);
+        data = file->data();
+        size = file->size();
+    }
+
+    try {
+        parse_buffer(data, size, sink);
+    } catch (const std::runtime_error& ex) {
+        throw std::runtime_error(std::string(ex.what()) + ": " + file_path);
+    }
+}
+
+void MoParser::parse_buffer(const char* data, size_t size, core::EntrySink& sink) {
+    if (size < MO_HEADER_SIZE) {
+        throw std::runtime_error("Not an MO file");
+    }
+
+    uint32_t magic;
+    std::memcpy(&magic, data, sizeof(magic));
+    if (magic != MO_MAGIC && magic != MO_MAGIC_SWAPPED) {
+        throw std::runtime_error("Not an MO file");
+    }
+    bool swapped = (magic == MO_MAGIC_SWAPPED);
+
+    auto read_u32 = [data, swapped](uint64_t offset) {
+        uint32_t value;
+        std::memcpy(&value, data + offset, sizeof(value));
+        if (swapped) {
+            value = ((value & 0xFF) << 24) | ((value & 0xFF00) << 8) |
+                    ((value >> 8) & 0xFF00) | (value >> 24);
+        }
+        return value;
+    };
+
+    uint64_t num_strings = read_u32(8);
+    uint64_t originals_offset = read_u32(12);
+    uint64_t translations_offset = read_u32(16);
+    if (originals_offset + num_strings * 8 > size ||
+        translations_offset + num_strings * 8 > size) {
+        throw std::runtime_error("Corrupted MO file");
+    }
+
+    auto read_string = [&](uint64_t table_offset, uint64_t index) {
+        uint64_t length = read_u32(table_offset + index * 8);
+        uint64_t offset = read_u32(table_offset + index * 8 + 4);
+        if (offset + length > size) {
+            throw std::runtime_error("Corrupted MO file");
+        }
+        return std::string(data + offset, length);
+    };
+
+    for (uint64_t i = 0; i < num_strings; ++i) {
+        sink.add_entry(core::TranslationEntry(read_string(originals_offset, i),
+                                              read_string(translations_offset, i)));
+    }
+}
+
+} // namespace mo
+} // namespace format
+} // namespace gettextify
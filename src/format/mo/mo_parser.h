@@ -0,0 +1,41 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_FORMAT_MO_PARSER_H
+#define GETTEXTIFY_FORMAT_MO_PARSER_H
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "../parser.h"
+#include "../../core/export.h"
+
+namespace gettextify {
+namespace format {
+namespace mo {
+
+/**
+ * Reader for compiled MO (Machine Object) files
+ *
+ * Both byte orders are accepted. The header entry (empty msgid) is
+ * emitted like any other entry. gzip and zstd compressed files are
+ * decompressed into memory first.
+ */
+class GETTEXTIFY_API MoParser : public Parser {
+public:
+    MoParser() = default;
+
+    void parse(const std::string& file_path, core::EntrySink& sink) override;
+    void parse_buffer(const char* data, size_t size, core::EntrySink& sink);
+
+private:
+    static constexpr uint32_t MO_MAGIC = 0x950412de;
+    static constexpr uint32_t MO_MAGIC_SWAPPED = 0xde120495;
+    static constexpr size_t MO_HEADER_SIZE = 28;
+};
+
+} // namespace mo
+} // namespace format
+} // namespace gettextify
+
+#endif // GETTEXTIFY_FORMAT_MO_PARSER_H
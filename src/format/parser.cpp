@@ -0,0 +1,38 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "parser.h"
+#include <filesystem>
+#include "csv/csv_parser.h"
+#include "json/json_parser.h"
+#include "mo/mo_parser.h"
+
+namespace fs = std::filesystem;
+
+namespace gettextify {
+namespace format {
+
+std::unique_ptr<Parser> make_parser(const std::string& file_path,
+                                    char delimiter,
+                                    const std::string& key_separator,
+                                    bool keep_comments) {
+    // Look through a compression suffix
+    fs::path path(file_path);
+    if (path.extension() == ".gz" || path.extension() == ".zst") {
+        path = path.stem();
+    }
+    
+    if (path.extension() == ".json") {
+        return std::make_unique<json::JsonParser>(key_separator);
+    }
+    if (path.extension() == ".mo") {
+        return std::make_unique<mo::MoParser>();
+    }
+    auto parser = std::make_unique<csv::CsvParser>(delimiter);
+    parser->set_background_decompression(true);
+    parser->set_keep_comments(keep_comments);
+    return parser;
+}
+
+} // namespace format
+} // namespace gettextify
@@ -0,0 +1,44 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_FORMAT_PARSER_H
+#define GETTEXTIFY_FORMAT_PARSER_H
+
+#include <string>
+#include <memory>
+#include "../core/entry_sink.h"
+#include "../core/export.h"
+
+namespace gettextify {
+namespace format {
+
+/**
+ * Common interface for input format parsers
+ *
+ * Parsers push entries into a sink as they are read, so the consumer may
+ * be a core::Catalog or a streaming stage such as engine::CompilePipeline.
+ */
+class GETTEXTIFY_API Parser {
+public:
+    virtual ~Parser() = default;
+
+    virtual void parse(const std::string& file_path, core::EntrySink& sink) = 0;
+};
+
+/**
+ * Creates the parser for a file based on its extension
+ *
+ * ".json" and ".mo" select the JSON and MO parsers, anything else is read
+ * as CSV. A trailing ".gz" or ".zst" is skipped, e.g. "app.json.gz".
+ * Callers that never read comments can pass keep_comments = false so CSV
+ * input skips the comment column.
+ */
+GETTEXTIFY_API std::unique_ptr<Parser> make_parser(const std::string& file_path,
+                                                   char delimiter = ',',
+                                                   const std::string& key_separator = ".",
+                                                   bool keep_comments = true);
+
+} // namespace format
+} // namespace gettextify
+
+#endif // GETTEXTIFY_FORMAT_PARSER_H
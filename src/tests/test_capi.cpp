@@ -0,0 +1,108 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../capi/gettextify.h"
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+void test_capi_compile_to_buffer() {
+    gettextify_catalog* catalog = gettextify_catalog_new();
+    assert(catalog != nullptr);
+    
+    const char* msgid = "Hello";
+    const char* msgstr = "Привет";
+    assert(gettextify_catalog_add(catalog, msgid, std::strlen(msgid),
+                                  msgstr, std::strlen(msgstr)) == GETTEXTIFY_OK);
+    assert(gettextify_catalog_size(catalog) == 1);
+    
+    gettextify_metadata metadata = {};
+    metadata.language = "ru";
+    
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    assert(gettextify_compile_mo(catalog, &metadata, &data, &size) == GETTEXTIFY_OK);
+    assert(data != nullptr);
+    assert(size > 28);
+    
+    uint32_t magic;
+    std::memcpy(&magic, data, sizeof(magic));
+    assert(magic == 0x950412de);
+    
+    std::string image(reinterpret_cast<const char*>(data), size);
+    assert(image.find("Language: ru\n") != std::string::npos);
+    assert(image.find("Привет") != std::string::npos);
+    
+    gettextify_buffer_free(data);
+    gettextify_catalog_free(catalog);
+    std::cout << "✓ test_capi_compile_to_buffer passed\n";
+}
+
+void test_capi_load() {
+    gettextify_catalog* catalog = gettextify_catalog_new();
+    
+    assert(gettextify_catalog_load(catalog, "src/tests/data/basic.csv") == GETTEXTIFY_OK);
+    assert(gettextify_catalog_size(catalog) == 5);
+    
+    assert(gettextify_catalog_load(catalog, "src/tests/data/missing.csv") == GETTEXTIFY_ERROR);
+    assert(std::string(gettextify_last_error()).find("missing.csv") != std::string::npos);
+    
+    gettextify_catalog_free(catalog);
+    std::cout << "✓ test_capi_load passed\n";
+}
+
+void test_capi_invalid_arguments() {
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    assert(gettextify_compile_mo(nullptr, nullptr, &data, &size) == GETTEXTIFY_ERROR);
+    assert(std::strlen(gettextify_last_error()) > 0);
+    assert(gettextify_catalog_add(nullptr, "a", 1, "b", 1) == GETTEXTIFY_ERROR);
+    
+    std::cout << "✓ test_capi_invalid_arguments passed\n";
+}
+
+void test_capi_concurrent_compile() {
+    gettextify_catalog* catalog = gettextify_catalog_new();
+    assert(gettextify_catalog_load(catalog, "src/tests/data/basic.csv") == GETTEXTIFY_OK);
+    
+    // One shared catalog compiled from several threads at once
+    std::vector<std::thread> threads;
+    std::vector<int> failures(8, 0);
+    for (size_t i = 0; i < failures.size(); ++i) {
+        threads.emplace_back([catalog, &failures, i]() {
+            for (int round = 0; round < 20; ++round) {
+                uint8_t* data = nullptr;
+                size_t size = 0;
+                if (gettextify_compile_mo(catalog, nullptr, &data, &size) != GETTEXTIFY_OK ||
+                    size == 0) {
+                    ++failures[i];
+                }
+                gettextify_buffer_free(data);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int count : failures) {
+        assert(count == 0);
+    }
+    
+    gettextify_catalog_free(catalog);
+    std::cout << "✓ test_capi_concurrent_compile passed\n";
+}
+
+int main() {
+    std::cout << "Running C API tests...\n";
+    
+    test_capi_compile_to_buffer();
+    test_capi_load();
+    test_capi_invalid_arguments();
+    test_capi_concurrent_compile();
+    
+    std::cout << "\nAll C API tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../core/catalog_diff.h"
+#include "../core/catalog.h"
+#include <cassert>
+#include <iostream>
+
+using namespace gettextify::core;
+
+void test_diff_identical() {
+    Catalog old_catalog;
+    old_catalog.add_entry("Hello", "Привет");
+    old_catalog.add_entry("Exit", "Выход");
+    
+    Catalog new_catalog;
+    new_catalog.add_entry("Exit", "Выход");
+    new_catalog.add_entry("Hello", "Привет", "Comments are not compared");
+    
+    assert(diff_catalogs(old_catalog, new_catalog).empty());
+    
+    std::cout << "✓ test_diff_identical passed\n";
+}
+
+void test_diff_changes() {
+    Catalog old_catalog;
+    old_catalog.add_entry("", "Project-Id-Version: old\n");
+    old_catalog.add_entry("Hello", "Привет");
+    old_catalog.add_entry("File", "Файл");
+    old_catalog.add_entry("Edit", "Правка");
+    
+    Catalog new_catalog;
+    new_catalog.add_entry("", "Project-Id-Version: new\n");
+    new_catalog.add_entry("Hello", "Здравствуйте", "Formal");
+    new_catalog.add_entry("Edit", "Правка");
+    new_catalog.add_entry("View", "Вид");
+    
+    CatalogDiff diff = diff_catalogs(old_catalog, new_catalog);
+    
+    assert(diff.added.size() == 1);
+    assert(diff.added[0].msgid == "View");
+    assert(diff.removed.size() == 1);
+    assert(diff.removed[0].msgid == "File");
+    assert(diff.changed.size() == 1);
+    assert(diff.changed[0].msgid == "Hello");
+    assert(diff.changed[0].old_msgstr == "Привет");
+    assert(diff.changed[0].new_msgstr == "Здравствуйте");
+    assert(diff.changed[0].comment == "Formal");
+    
+    std::cout << "✓ test_diff_changes passed\n";
+}
+
+void test_diff_duplicates() {
+    Catalog old_catalog;
+    old_catalog.add_entry("Open", "Открыть");
+    
+    Catalog new_catalog;
+    new_catalog.add_entry("Open", "Отк");
+    new_catalog.add_entry("Open", "Открыть");
+    
+    // The last occurrence wins
+    assert(diff_catalogs(old_catalog, new_catalog).empty());
+    
+    CatalogDiff diff = diff_catalogs(new_catalog, old_catalog);
+    assert(diff.empty());
+    
+    std::cout << "✓ test_diff_duplicates passed\n";
+}
+
+int main() {
+    std::cout << "Running Catalog Diff tests...\n";
+    
+    test_diff_identical();
+    test_diff_changes();
+    test_diff_duplicates();
+    
+    std::cout << "\nAll Catalog Diff tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,172 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../engine/compile_pipeline.h"
+#include "../engine/mo_compiler.h"
+#include "../core/spsc_queue.h"
+#include "../core/catalog.h"
+#include <cassert>
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace gettextify::engine;
+using namespace gettextify::core;
+
+namespace fs = std::filesystem;
+
+static std::string read_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void test_spsc_queue_basic() {
+    SpscQueue<int> queue(3);
+    assert(queue.capacity() == 4);
+
+    for (int i = 0; i < 4; ++i) {
+        assert(queue.try_push(int(i)));
+    }
+    assert(!queue.try_push(4));
+
+    int value = -1;
+    assert(queue.try_pop(value) && value == 0);
+    assert(queue.try_push(4));
+
+    queue.close();
+    for (int expected = 1; expected <= 4; ++expected) {
+        assert(queue.pop(value) && value == expected);
+    }
+    assert(!queue.pop(value));
+
+    std::cout << "✓ test_spsc_queue_basic passed\n";
+}
+
+void test_spsc_queue_threaded() {
+    SpscQueue<int> queue(16);
+    const int count = 100000;
+
+    std::thread producer([&]() {
+        for (int i = 0; i < count; ++i) {
+            queue.push(int(i));
+        }
+        queue.close();
+    });
+
+    int value = 0;
+    int expected = 0;
+    while (queue.pop(value)) {
+        assert(value == expected);
+        ++expected;
+    }
+    producer.join();
+    assert(expected == count);
+
+    std::cout << "✓ test_spsc_queue_threaded passed\n";
+}
+
+void test_spsc_queue_cancel() {
+    SpscQueue<int> queue(2);
+    assert(queue.try_push(0) && queue.try_push(1));
+
+    // The producer sleeps on the full queue until cancel() releases it
+    bool pushed = true;
+    std::thread producer([&]() {
+        pushed = queue.push(2);
+    });
+    queue.cancel();
+    producer.join();
+
+    assert(!pushed);
+    std::cout << "✓ test_spsc_queue_cancel passed\n";
+}
+
+void test_pipeline_matches_compile() {
+    // Explicit header entry keeps the output independent of the clock
+    Catalog catalog;
+    catalog.add_entry("", "Content-Type: text/plain; charset=UTF-8\n");
+    for (int i = 999; i >= 0; --i) {
+        catalog.add_entry("msg " + std::to_string(i * 7919 % 1000), "Перевод " + std::to_string(i));
+    }
+
+    MoCompiler compiler;
+    compiler.compile(catalog, "test_direct.mo");
+
+    // Small queue and runs force several merge passes
+    CompilePipeline pipeline(compiler, 8, 37);
+    size_t count = pipeline.run([&catalog](EntrySink& sink) {
+        for (const auto& entry : catalog.get_entries()) {
+            sink.add_entry(TranslationEntry(entry));
+        }
+    }, "test_pipeline.mo");
+
+    assert(count == catalog.size());
+    assert(read_file("test_direct.mo") == read_file("test_pipeline.mo"));
+
+    fs::remove("test_direct.mo");
+    fs::remove("test_pipeline.mo");
+    std::cout << "✓ test_pipeline_matches_compile passed\n";
+}
+
+void test_pipeline_producer_error() {
+    MoCompiler compiler;
+    CompilePipeline pipeline(compiler);
+    std::string output = "test_pipeline_error.mo";
+
+    bool thrown = false;
+    try {
+        pipeline.run([](EntrySink& sink) {
+            sink.add_entry(TranslationEntry("Hello", "Привет"));
+            throw std::runtime_error("broken input");
+        }, output);
+    } catch (const std::runtime_error& ex) {
+        thrown = std::string(ex.what()) == "broken input";
+    }
+
+    assert(thrown);
+    assert(!fs::exists(output));
+
+    std::cout << "✓ test_pipeline_producer_error passed\n";
+}
+
+void test_pipeline_consumer_error() {
+    MoCompiler compiler;
+    CompilePipeline pipeline(compiler, 4, 16);
+
+    // The producer never finishes on its own, so the consumer must cancel it
+    size_t produced = 0;
+    bool thrown = false;
+    try {
+        pipeline.run([&produced](EntrySink& sink) {
+            for (;;) {
+                sink.add_entry(TranslationEntry("msg " + std::to_string(produced), "x"));
+                ++produced;
+            }
+        }, "missing_pipeline_dir/out.mo");
+    } catch (const std::runtime_error& ex) {
+        thrown = std::string(ex.what()).find("missing_pipeline_dir") != std::string::npos;
+    }
+
+    assert(thrown);
+    assert(!fs::exists("missing_pipeline_dir"));
+
+    std::cout << "✓ test_pipeline_consumer_error passed\n";
+}
+
+int main() {
+    std::cout << "Running Compile Pipeline tests...\n";
+
+    test_spsc_queue_basic();
+    test_spsc_queue_threaded();
+    test_spsc_queue_cancel();
+    test_pipeline_matches_compile();
+    test_pipeline_producer_error();
+    test_pipeline_consumer_error();
+
+    std::cout << "\nAll Compile Pipeline tests passed!\n";
+    return 0;
+}
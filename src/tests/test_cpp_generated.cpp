@@ -0,0 +1,51 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+// Compiles the tables the CLI generates from data/generated.csv, so the
+// emitted hash() and string literals are checked by a real compiler
+#include "generated_strings.h"
+#include "../format/csv/csv_parser.h"
+#include "../core/catalog.h"
+#include <cassert>
+#include <iostream>
+#include <string_view>
+
+using namespace gettextify::format::csv;
+using namespace gettextify::core;
+
+void test_generated_lookup() {
+    Catalog catalog;
+    CsvParser parser;
+    parser.parse("src/tests/data/generated.csv", catalog);
+    
+    size_t translated = 0;
+    for (const auto& entry : catalog.get_entries()) {
+        assert(generated::lookup(entry.msgid) == std::string_view(entry.msgstr));
+        if (!entry.msgstr.empty()) {
+            ++translated;
+        }
+    }
+    assert(translated == generated::entry_count);
+    assert(generated::lookup("Really?").empty());
+    assert(generated::lookup(std::string_view("Hello", 4)).empty());
+    
+    std::cout << "✓ test_generated_lookup passed\n";
+}
+
+void test_generated_translate() {
+    assert(generated::translate("Hello") == "Привет");
+    assert(generated::translate("Untranslated") == "Untranslated");
+    assert(generated::translate("Missing") == "Missing");
+    
+    std::cout << "✓ test_generated_translate passed\n";
+}
+
+int main() {
+    std::cout << "Running Generated C++ tests...\n";
+    
+    test_generated_lookup();
+    test_generated_translate();
+    
+    std::cout << "\nAll Generated C++ tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,187 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../engine/cpp_generator.h"
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace gettextify::engine;
+using namespace gettextify::core;
+
+void test_perfect_hash_is_minimal() {
+    std::vector<std::string> storage;
+    for (int i = 0; i < 10000; ++i) {
+        storage.push_back("msgid " + std::to_string(i));
+    }
+    std::vector<std::string_view> keys(storage.begin(), storage.end());
+    
+    PerfectHash perfect_hash = CppGenerator::build_perfect_hash(keys);
+    assert(perfect_hash.displacements.size() == 2500);
+    
+    std::vector<bool> seen(keys.size(), false);
+    for (auto key : keys) {
+        uint32_t slot = perfect_hash.slot(key, static_cast<uint32_t>(keys.size()));
+        assert(slot < keys.size());
+        assert(!seen[slot]);
+        seen[slot] = true;
+    }
+    
+    std::cout << "✓ test_perfect_hash_is_minimal passed\n";
+}
+
+void test_perfect_hash_rejects_duplicates() {
+    std::vector<std::string_view> keys = {"a", "b", "a", "c", "d"};
+    
+    bool thrown = false;
+    try {
+        CppGenerator::build_perfect_hash(keys);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "✓ test_perfect_hash_rejects_duplicates passed\n";
+}
+
+void test_cpp_generate() {
+    Catalog catalog;
+    catalog.add_entry("", "Content-Type: text/plain; charset=UTF-8\n");
+    catalog.add_entry("Hello", "Привет");
+    catalog.add_entry("Say \"hi\"", "Скажи \"привет\"");
+    catalog.add_entry("Untranslated", "");
+    catalog.add_entry("Hello", "Здравствуйте");
+    
+    CppGenerator generator("app::i18n");
+    std::ostringstream header;
+    std::ostringstream source;
+    generator.generate(catalog, header, source, "strings.h");
+    
+    std::string h = header.str();
+    assert(h.find("#ifndef GETTEXTIFY_GENERATED_APP_I18N_STRINGS_H") != std::string::npos);
+    assert(h.find("namespace app::i18n {") != std::string::npos);
+    assert(h.find("constexpr std::size_t entry_count = 2;") != std::string::npos);
+    
+    std::string s = source.str();
+    assert(s.find("#include \"strings.h\"") != std::string::npos);
+    assert(s.find("\"Say \\\"hi\\\"\"") != std::string::npos);
+    assert(s.find("\"Hello\"") != std::string::npos);
+    assert(s.find("Untranslated") == std::string::npos);
+    assert(s.find("Content-Type") == std::string::npos);
+    
+    // UTF-8 is written as octal escapes; the later duplicate wins
+    assert(s.find("\\320\\227") != std::string::npos);
+    assert(s.find("\\320\\237\\321\\200") == std::string::npos);
+    
+    std::cout << "✓ test_cpp_generate passed\n";
+}
+
+// Decodes the string literals written by the generator
+static std::string unescape_literal(const std::string& literal) {
+    std::string result;
+    for (size_t i = 1; i + 1 < literal.size(); ++i) {
+        if (literal[i] != '\\') {
+            result += literal[i];
+        } else if (literal[i + 1] >= '0' && literal[i + 1] <= '7') {
+            result += static_cast<char>(std::strtol(literal.substr(i + 1, 3).c_str(), nullptr, 8));
+            i += 3;
+        } else {
+            result += literal[++i];
+        }
+    }
+    return result;
+}
+
+void test_cpp_lookup_round_trip() {
+    Catalog catalog;
+    for (int i = 0; i < 500; ++i) {
+        catalog.add_entry("Really?\?= " + std::to_string(i), "Правда?? " + std::to_string(i));
+    }
+    
+    CppGenerator generator;
+    std::ostringstream header;
+    std::ostringstream source;
+    generator.generate(catalog, header, source, "strings.h");
+    
+    // Read the emitted tables back exactly as lookup() uses them
+    std::istringstream lines(source.str());
+    std::string line;
+    std::string strings;
+    std::vector<std::vector<uint32_t>> entries;
+    PerfectHash perfect_hash;
+    enum { NONE, STRINGS, ENTRIES, DISPLACEMENTS } section = NONE;
+    while (std::getline(lines, line)) {
+        if (line.find("constexpr char strings[]") == 0) {
+            section = STRINGS;
+        } else if (line.find("constexpr Entry entries[") == 0) {
+            section = ENTRIES;
+        } else if (line.find("constexpr std::int32_t displacements[") == 0) {
+            section = DISPLACEMENTS;
+        } else if (line.find("};") == 0 || line == "    ;") {
+            section = NONE;
+        } else if (section == STRINGS) {
+            assert(line.find("??") == std::string::npos);
+            strings += unescape_literal(line.substr(4));
+        } else if (section == ENTRIES) {
+            std::vector<uint32_t> fields;
+            std::istringstream values(line.substr(line.find('{') + 1));
+            uint32_t value;
+            char separator;
+            while (values >> value) {
+                fields.push_back(value);
+                values >> separator;
+            }
+            assert(fields.size() == 4);
+            entries.push_back(fields);
+        } else if (section == DISPLACEMENTS) {
+            std::istringstream values(line);
+            int32_t value;
+            char separator;
+            while (values >> value >> separator) {
+                perfect_hash.displacements.push_back(value);
+            }
+        }
+    }
+    assert(entries.size() == 500);
+    assert(perfect_hash.displacements.size() == 125);
+    
+    for (const auto& entry : catalog.get_entries()) {
+        const auto& slot = entries[perfect_hash.slot(entry.msgid, 500)];
+        assert(strings.substr(slot[0], slot[1]) == entry.msgid);
+        assert(strings.substr(slot[2], slot[3]) == entry.msgstr);
+    }
+    
+    const auto& miss = entries[perfect_hash.slot("Not in the catalog", 500)];
+    assert(strings.substr(miss[0], miss[1]) != "Not in the catalog");
+    
+    std::cout << "✓ test_cpp_lookup_round_trip passed\n";
+}
+
+void test_cpp_invalid_namespace() {
+    bool thrown = false;
+    try {
+        CppGenerator generator("1app");
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "✓ test_cpp_invalid_namespace passed\n";
+}
+
+int main() {
+    std::cout << "Running C++ Generator tests...\n";
+    
+    test_perfect_hash_is_minimal();
+    test_perfect_hash_rejects_duplicates();
+    test_cpp_generate();
+    test_cpp_lookup_round_trip();
+    test_cpp_invalid_namespace();
+    
+    std::cout << "\nAll C++ Generator tests passed!\n";
+    return 0;
+}
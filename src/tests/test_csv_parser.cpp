@@ -2,10 +2,14 @@
 // This code licensed under LGPL 3.0
 
 #include "../format/csv/csv_parser.h"
+#include "../format/csv/csv_writer.h"
+#include "../format/json/json_parser.h"
 #include "../core/catalog.h"
 #include <cassert>
 #include <iostream>
 #include <filesystem>
+#include <fstream>
+#include <stdexcept>
 
 using namespace gettextify::format::csv;
 using namespace gettextify::core;
@@ -54,6 +58,86 @@ void test_csv_quoted_fields() {
     std::cout << "✓ test_csv_quoted_fields passed\n";
 }
 
+void test_csv_compressed_input() {
+#ifdef GETTEXTIFY_HAVE_ZLIB
+    CsvParser parser(',');
+    parser.set_background_decompression(true);
+    Catalog catalog;
+    
+    fs::path test_file = "src/tests/data/basic.csv.gz";
+    parser.parse(test_file.string(), catalog);
+    
+    assert(catalog.size() == 5);
+    assert(catalog.get_entries()[4].msgid == "Good morning");
+    assert(catalog.get_entries()[4].msgstr == "Доброе утро");
+    
+    std::cout << "✓ test_csv_compressed_input passed\n";
+#else
+    std::cout << "- test_csv_compressed_input skipped (built without zlib)\n";
+#endif
+}
+
+void test_csv_writer_round_trip() {
+    Catalog catalog;
+    catalog.add_entry("She said \"Hello\"", "Она сказала \"Привет\"", "Quoted; text");
+    catalog.add_entry("Exit", "Выход");
+    
+    std::string output = "test_writer.csv";
+    CsvWriter writer(';');
+    writer.write(catalog.get_entries(), output);
+    
+    CsvParser parser(';');
+    Catalog parsed;
+    parser.parse(output, parsed);
+    
+    assert(parsed.size() == 2);
+    assert(parsed.get_entries()[0].msgid == "She said \"Hello\"");
+    assert(parsed.get_entries()[0].msgstr == "Она сказала \"Привет\"");
+    assert(parsed.get_entries()[0].comment == "Quoted; text");
+    assert(parsed.get_entries()[1].msgid == "Exit");
+    
+    fs::remove(output);
+    std::cout << "✓ test_csv_writer_round_trip passed\n";
+}
+
+void test_csv_multiline_round_trip() {
+    Catalog catalog;
+    gettextify::format::json::JsonParser json;
+    json.parse("src/tests/data/flat.json", catalog);
+    
+    std::string output = "test_multiline.csv";
+    CsvWriter writer;
+    writer.write(catalog.get_entries(), output);
+    
+    CsvParser parser;
+    Catalog parsed;
+    parser.parse(output, parsed);
+    
+    assert(parsed.size() == catalog.size());
+    for (size_t i = 0; i < catalog.size(); ++i) {
+        assert(parsed.get_entries()[i].msgid == catalog.get_entries()[i].msgid);
+        assert(parsed.get_entries()[i].msgstr == catalog.get_entries()[i].msgstr);
+    }
+    assert(parsed.get_entries()[3].msgid == "Line\nbreak");
+    
+    // A quote left open at the end of the file is an error
+    {
+        std::ofstream file(output);
+        file << "msgid,msgstr\n\"Open,\"Открыто\"\nNext,Далее\n";
+    }
+    bool thrown = false;
+    try {
+        Catalog broken;
+        parser.parse(output, broken);
+    } catch (const std::runtime_error& ex) {
+        thrown = std::string(ex.what()).find("line 2") != std::string::npos;
+    }
+    assert(thrown);
+    
+    fs::remove(output);
+    std::cout << "✓ test_csv_multiline_round_trip passed\n";
+}
+
 void test_csv_delimiter_change() {
     CsvParser parser(',');
     assert(parser.get_delimiter() == ',');
@@ -64,13 +148,134 @@ void test_csv_delimiter_change() {
     std::cout << "✓ test_csv_delimiter_change passed\n";
 }
 
+void test_csv_multilingual() {
+    CsvParser parser(',');
+    auto catalog = parser.parse_multilingual("src/tests/data/multilingual.csv");
+    
+    assert(catalog.get_languages().size() == 2);
+    assert(catalog.get_languages()[0] == "ru");
+    assert(catalog.get_languages()[1] == "de");
+    assert(catalog.size() == 4);
+    assert(catalog.msgid(0) == "Hello");
+    assert(catalog.msgstr(0, 0) == "Привет");
+    assert(catalog.msgstr(0, 1) == "Hallo");
+    assert(catalog.msgstr(1, 1).empty());
+    
+    // Missing trailing cells are empty
+    assert(catalog.msgid(3) == "Zebra");
+    assert(catalog.msgstr(3, 1).empty());
+    
+    auto german = parser.parse_multilingual("src/tests/data/multilingual.csv", {"de"});
+    assert(german.get_languages().size() == 1);
+    assert(german.msgstr(2, 0) == "Apfel");
+    
+    bool thrown = false;
+    try {
+        parser.parse_multilingual("src/tests/data/multilingual.csv", {"fr"});
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    thrown = false;
+    try {
+        parser.parse_multilingual("src/tests/data/multilingual.csv", {"ru", "ru"});
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    // msgstr is never taken for a language
+    std::string path = "test_multilingual_msgstr.csv";
+    {
+        std::ofstream file(path);
+        file << "msgid,msgstr,ru,comment\n\"Hello\",\"Hi\",\"Привет\",\"\"\n";
+    }
+    auto with_msgstr = parser.parse_multilingual(path);
+    assert(with_msgstr.get_languages().size() == 1);
+    assert(with_msgstr.get_languages()[0] == "ru");
+    
+    // Two columns with the same name would write the same output file
+    {
+        std::ofstream file(path);
+        file << "msgid,ru,de,ru\n\"Hello\",\"Привет\",\"Hallo\",\"Здравствуйте\"\n";
+    }
+    thrown = false;
+    try {
+        parser.parse_multilingual(path);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    // Extra columns are only accepted when the languages are listed
+    {
+        std::ofstream file(path);
+        file << "msgid,context,pt_BR,sr@latin,notes\n\"Hello\",\"menu\",\"Olá\",\"Zdravo\",\"\"\n";
+    }
+    thrown = false;
+    try {
+        parser.parse_multilingual(path);
+    } catch (const std::runtime_error& ex) {
+        thrown = std::string(ex.what()).find("'context'") != std::string::npos;
+    }
+    assert(thrown);
+    auto listed = parser.parse_multilingual(path, {"pt_BR", "sr@latin"});
+    assert(listed.get_languages().size() == 2);
+    assert(listed.msgstr(0, 1) == "Zdravo");
+    {
+        std::ofstream file(path);
+        file << "msgid,pt_BR,zh-Hant,sr@latin\n\"Hello\",\"Olá\",\"你好\",\"Zdravo\"\n";
+    }
+    assert(parser.parse_multilingual(path).get_languages().size() == 3);
+    fs::remove(path);
+    
+    std::cout << "✓ test_csv_multilingual passed\n";
+}
+
+void test_csv_column_projection() {
+    CsvParser parser(',');
+    Catalog full;
+    parser.parse("src/tests/data/wide.csv", full);
+    
+    // The last row has no comment field and is skipped
+    assert(full.size() == 3);
+    assert(full.get_entries()[0].msgid == "Hello");
+    assert(full.get_entries()[0].msgstr == "Привет");
+    assert(full.get_entries()[0].comment == "Greeting");
+    assert(full.get_entries()[1].msgid == "Open");
+    assert(full.get_entries()[1].msgstr == "Открыть");
+    assert(full.get_entries()[2].msgid == "Quote \"me\"");
+    assert(full.get_entries()[2].msgstr == "Цитата \"меня\"");
+    assert(full.get_entries()[2].comment == "Quoted");
+    
+    parser.set_keep_comments(false);
+    assert(!parser.get_keep_comments());
+    Catalog projected;
+    parser.parse("src/tests/data/wide.csv", projected);
+    
+    assert(projected.size() == full.size());
+    for (size_t i = 0; i < projected.size(); ++i) {
+        assert(projected.get_entries()[i].msgid == full.get_entries()[i].msgid);
+        assert(projected.get_entries()[i].msgstr == full.get_entries()[i].msgstr);
+        assert(projected.get_entries()[i].comment.empty());
+    }
+    
+    std::cout << "✓ test_csv_column_projection passed\n";
+}
+
 int main() {
     std::cout << "Running CSV Parser tests...\n";
     
     test_csv_basic_parsing();
     test_csv_semicolon_delimiter();
     test_csv_quoted_fields();
+    test_csv_compressed_input();
+    test_csv_writer_round_trip();
+    test_csv_multiline_round_trip();
     test_csv_delimiter_change();
+    test_csv_multilingual();
+    test_csv_column_projection();
     
     std::cout << "\nAll CSV Parser tests passed!\n";
     return 0;
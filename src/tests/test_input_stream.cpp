@@ -0,0 +1,104 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../format/input_stream.h"
+#include <cassert>
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace gettextify::format;
+
+static std::vector<std::string> read_lines_reference(const std::string& path) {
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(file, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+static std::vector<std::string> read_lines(const std::string& path, bool background,
+                                           size_t chunk_size) {
+    InputStream input(path, background, chunk_size);
+    std::vector<std::string> lines;
+    std::string line;
+    while (input.getline(line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+static void check_lines(const std::string& path) {
+    auto expected = read_lines_reference("src/tests/data/basic.csv");
+    for (size_t chunk_size : {1, 7, 64, 4096}) {
+        assert(read_lines(path, false, chunk_size) == expected);
+        assert(read_lines(path, true, chunk_size) == expected);
+    }
+}
+
+void test_detect_compression() {
+    assert(detect_compression("src/tests/data/basic.csv") == Compression::NONE);
+    assert(detect_compression("src/tests/data/basic.csv.gz") == Compression::GZIP);
+    assert(detect_compression("src/tests/data/basic.csv.zst") == Compression::ZSTD);
+
+    std::cout << "✓ test_detect_compression passed\n";
+}
+
+void test_plain_lines() {
+    check_lines("src/tests/data/basic.csv");
+    std::cout << "✓ test_plain_lines passed\n";
+}
+
+void test_gzip_lines() {
+#ifdef GETTEXTIFY_HAVE_ZLIB
+    check_lines("src/tests/data/basic.csv.gz");
+    std::cout << "✓ test_gzip_lines passed\n";
+#else
+    std::cout << "- test_gzip_lines skipped (built without zlib)\n";
+#endif
+}
+
+void test_zstd_lines() {
+#ifdef GETTEXTIFY_HAVE_ZSTD
+    check_lines("src/tests/data/basic.csv.zst");
+    std::cout << "✓ test_zstd_lines passed\n";
+#else
+    std::cout << "- test_zstd_lines skipped (built without libzstd)\n";
+#endif
+}
+
+void test_read_chunk_after_getline() {
+    InputStream input("src/tests/data/basic.csv", false, 16);
+    std::string line;
+    assert(input.getline(line));
+    assert(line == "msgid,msgstr,comment");
+
+    std::string rest;
+    std::string chunk;
+    while (input.read_chunk(chunk)) {
+        rest += chunk;
+    }
+
+    std::ifstream file("src/tests/data/basic.csv", std::ios::binary);
+    std::string all((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    assert(rest == all.substr(line.size() + 1));
+
+    std::cout << "✓ test_read_chunk_after_getline passed\n";
+}
+
+int main() {
+    std::cout << "Running Input Stream tests...\n";
+
+    test_detect_compression();
+    test_plain_lines();
+    test_gzip_lines();
+    test_zstd_lines();
+    test_read_chunk_after_getline();
+
+    std::cout << "\nAll Input Stream tests passed!\n";
+    return 0;
+}
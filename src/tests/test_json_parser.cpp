@@ -0,0 +1,138 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../format/json/json_parser.h"
+#include "../core/catalog.h"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace gettextify::format::json;
+using namespace gettextify::core;
+
+void test_json_flat_parsing() {
+    JsonParser parser;
+    Catalog catalog;
+
+    parser.parse("src/tests/data/flat.json", catalog);
+
+    assert(catalog.size() == 4);
+    assert(catalog.get_entries()[0].msgid == "Hello");
+    assert(catalog.get_entries()[0].msgstr == "Привет");
+    assert(catalog.get_entries()[2].msgid == "She said \"Hello\"");
+    assert(catalog.get_entries()[2].msgstr == "Она сказала \"Привет\"");
+    assert(catalog.get_entries()[3].msgid == "Line\nbreak");
+    assert(catalog.get_entries()[3].msgstr == "Перенос");
+
+    std::cout << "✓ test_json_flat_parsing passed\n";
+}
+
+void test_json_nested_flattening() {
+    JsonParser parser;
+    Catalog catalog;
+
+    parser.parse("src/tests/data/nested.json", catalog);
+
+    // Non-string values are skipped
+    assert(catalog.size() == 4);
+    assert(catalog.get_entries()[0].msgid == "menu.file");
+    assert(catalog.get_entries()[0].msgstr == "Файл");
+    assert(catalog.get_entries()[1].msgid == "menu.edit.copy");
+    assert(catalog.get_entries()[2].msgid == "menu.edit.paste");
+    assert(catalog.get_entries()[3].msgid == "exit");
+    assert(catalog.get_entries()[3].msgstr == "Выход");
+
+    // An empty parent key still contributes a separator
+    Catalog empty_key;
+    std::string json = R"({"": {"a": "x"}, "a": "y"})";
+    parser.parse_buffer(json.data(), json.size(), empty_key);
+    assert(empty_key.size() == 2);
+    assert(empty_key.get_entries()[0].msgid == ".a");
+    assert(empty_key.get_entries()[1].msgid == "a");
+
+    std::cout << "✓ test_json_nested_flattening passed\n";
+}
+
+void test_json_custom_separator() {
+    JsonParser parser("/");
+    Catalog catalog;
+
+    std::string json = R"({"a": {"b": {"c": "x"}}, "d": "y"})";
+    parser.parse_buffer(json.data(), json.size(), catalog);
+
+    assert(catalog.size() == 2);
+    assert(catalog.get_entries()[0].msgid == "a/b/c");
+    assert(catalog.get_entries()[1].msgid == "d");
+
+    parser.set_separator("::");
+    assert(parser.get_separator() == "::");
+
+    std::cout << "✓ test_json_custom_separator passed\n";
+}
+
+void test_json_surrogate_pair() {
+    JsonParser parser;
+    Catalog catalog;
+
+    std::string json = R"({"smile": "\uD83D\uDE00"})";
+    parser.parse_buffer(json.data(), json.size(), catalog);
+
+    assert(catalog.size() == 1);
+    assert(catalog.get_entries()[0].msgstr == "\xF0\x9F\x98\x80");
+
+    std::cout << "✓ test_json_surrogate_pair passed\n";
+}
+
+void test_json_malformed_input() {
+    JsonParser parser;
+    Catalog catalog;
+
+    std::string json = "{\n  \"a\": \"b\"\n  \"c\": \"d\"\n}";
+    bool thrown = false;
+    try {
+        parser.parse_buffer(json.data(), json.size(), catalog);
+    } catch (const std::runtime_error& ex) {
+        thrown = std::string(ex.what()).find("line 3") != std::string::npos;
+    }
+    assert(thrown);
+
+    // Scalars must be exact literals or valid numbers
+    const char* invalid[] = {
+        "{\"a\": tttt}", "{\"a\": --e}", "{\"a\": nul}", "{\"a\": truex}",
+        "{\"a\": 01}", "{\"a\": 1.}", "{\"a\": 1e}", "{\"a\": .5}", "{\"a\": +1}",
+        "{\"a\\u0000b\": \"c\"}", "{\"a\": \"\\u0000\"}",
+    };
+    for (const char* text : invalid) {
+        std::string input = text;
+        thrown = false;
+        try {
+            Catalog rejected;
+            parser.parse_buffer(input.data(), input.size(), rejected);
+        } catch (const std::runtime_error& ex) {
+            thrown = std::string(ex.what()).find("line 1") != std::string::npos;
+        }
+        assert(thrown);
+    }
+
+    std::string valid = "{\"a\": -0.5e+3, \"b\": [true, false, null, 10, 2E-2], \"c\": \"d\"}";
+    Catalog accepted;
+    parser.parse_buffer(valid.data(), valid.size(), accepted);
+    assert(accepted.size() == 1);
+    assert(accepted.get_entries()[0].msgid == "c");
+
+    std::cout << "✓ test_json_malformed_input passed\n";
+}
+
+int main() {
+    std::cout << "Running JSON Parser tests...\n";
+
+    test_json_flat_parsing();
+    test_json_nested_flattening();
+    test_json_custom_separator();
+    test_json_surrogate_pair();
+    test_json_malformed_input();
+
+    std::cout << "\nAll JSON Parser tests passed!\n";
+    return 0;
+}
@@ -8,6 +8,8 @@
 #include <fstream>
 #include <filesystem>
 #include <cstdint>
+#include <cstring>
+#include <vector>
 
 using namespace gettextify::engine;
 using namespace gettextify::core;
@@ -86,6 +88,49 @@ void test_mo_utf8_handling() {
     std::cout << "✓ test_mo_utf8_handling passed\n";
 }
 
+void test_mo_compile_to_buffer() {
+    Catalog catalog;
+    catalog.add_entry("", "Content-Type: text/plain; charset=UTF-8\n");
+    catalog.add_entry("Hello", "Привет");
+    catalog.add_entry("Goodbye", "До свидания");
+    
+    MoCompiler compiler;
+    std::string output = "test_buffer.mo";
+    compiler.compile(catalog, output);
+    
+    auto buffer = compiler.compile_to_buffer(catalog);
+    assert(buffer.size() == fs::file_size(output));
+    
+    std::ifstream file(output, std::ios::binary);
+    std::vector<char> on_disk(buffer.size());
+    file.read(on_disk.data(), on_disk.size());
+    assert(std::memcmp(on_disk.data(), buffer.data(), buffer.size()) == 0);
+    
+    file.close();
+    fs::remove(output);
+    std::cout << "✓ test_mo_compile_to_buffer passed\n";
+}
+
+void test_mo_skips_untranslated() {
+    Catalog catalog;
+    catalog.add_entry("", "Content-Type: text/plain; charset=UTF-8\n");
+    catalog.add_entry("Hello", "Привет");
+    catalog.add_entry("Untranslated", "");
+    
+    Catalog translated;
+    translated.add_entry("", "Content-Type: text/plain; charset=UTF-8\n");
+    translated.add_entry("Hello", "Привет");
+    
+    // The empty msgstr leaves no trace in the image
+    MoCompiler compiler;
+    auto buffer = compiler.compile_to_buffer(catalog);
+    auto expected = compiler.compile_to_buffer(translated);
+    assert(buffer.size() == expected.size());
+    assert(std::memcmp(buffer.data(), expected.data(), buffer.size()) == 0);
+    
+    std::cout << "✓ test_mo_skips_untranslated passed\n";
+}
+
 int main() {
     std::cout << "Running MO Compiler tests...\n";
     
@@ -93,6 +138,8 @@ int main() {
     test_mo_magic_number();
     test_mo_empty_catalog();
     test_mo_utf8_handling();
+    test_mo_compile_to_buffer();
+    test_mo_skips_untranslated();
     
     std::cout << "\nAll MO Compiler tests passed!\n";
     return 0;
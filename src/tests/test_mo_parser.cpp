@@ -0,0 +1,90 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../format/mo/mo_parser.h"
+#include "../format/parser.h"
+#include "../engine/mo_compiler.h"
+#include "../core/catalog.h"
+#include <cassert>
+#include <iostream>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+using namespace gettextify::format::mo;
+using namespace gettextify::engine;
+using namespace gettextify::core;
+
+namespace fs = std::filesystem;
+
+void test_mo_round_trip() {
+    Catalog catalog;
+    catalog.add_entry("Hello", "Привет");
+    catalog.add_entry("Goodbye", "До свидания");
+    
+    MoCompiler compiler;
+    std::string output = "test_round_trip.mo";
+    compiler.compile(catalog, output);
+    
+    MoParser parser;
+    Catalog parsed;
+    parser.parse(output, parsed);
+    
+    // Header entry first, then msgids in sorted order
+    assert(parsed.size() == 3);
+    assert(parsed.get_entries()[0].msgid.empty());
+    assert(parsed.get_entries()[0].msgstr.find("Content-Type:") != std::string::npos);
+    assert(parsed.get_entries()[1].msgid == "Goodbye");
+    assert(parsed.get_entries()[1].msgstr == "До свидания");
+    assert(parsed.get_entries()[2].msgid == "Hello");
+    assert(parsed.get_entries()[2].msgstr == "Привет");
+    
+    fs::remove(output);
+    std::cout << "✓ test_mo_round_trip passed\n";
+}
+
+void test_mo_rejects_invalid_input() {
+    MoParser parser;
+    Catalog catalog;
+    
+    bool thrown = false;
+    try {
+        parser.parse("src/tests/data/basic.csv", catalog);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "✓ test_mo_rejects_invalid_input passed\n";
+}
+
+void test_mo_compressed_input() {
+#ifdef GETTEXTIFY_HAVE_ZLIB
+    // Format detection looks past the .gz suffix
+    auto parser = gettextify::format::make_parser("src/tests/data/basic.mo.gz");
+    Catalog catalog;
+    parser->parse("src/tests/data/basic.mo.gz", catalog);
+    
+    assert(catalog.size() == 6);
+    assert(catalog.get_entries()[0].msgid.empty());
+    assert(catalog.get_entries()[0].msgstr.find("Project-Id-Version: Test 1.0") != std::string::npos);
+    assert(catalog.get_entries()[1].msgid == "Good morning");
+    assert(catalog.get_entries()[1].msgstr == "Доброе утро");
+    assert(catalog.get_entries()[5].msgid == "Welcome");
+    
+    std::cout << "✓ test_mo_compressed_input passed\n";
+#else
+    std::cout << "- test_mo_compressed_input skipped (built without zlib)\n";
+#endif
+}
+
+int main() {
+    std::cout << "Running MO Parser tests...\n";
+    
+    test_mo_round_trip();
+    test_mo_rejects_invalid_input();
+    test_mo_compressed_input();
+    
+    std::cout << "\nAll MO Parser tests passed!\n";
+    return 0;
+}
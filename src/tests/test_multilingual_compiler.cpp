@@ -0,0 +1,153 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../engine/multilingual_compiler.h"
+#include "../format/mo/mo_parser.h"
+#include "../core/catalog.h"
+#include <cassert>
+#include <iostream>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace gettextify::engine;
+using namespace gettextify::core;
+
+namespace fs = std::filesystem;
+
+static MultilingualCatalog make_catalog() {
+    MultilingualCatalog catalog({"ru", "de"});
+    catalog.add_row("Hello", {"Привет", "Hallo"});
+    catalog.add_row("Goodbye", {"До свидания", ""});
+    catalog.add_row("Apple", {"Яблоко", "Apfel"});
+    return catalog;
+}
+
+void test_multilingual_expand_path() {
+    assert(MultilingualCompiler::expand_path("out/{lang}/LC_MESSAGES/app.mo", "ru") ==
+           "out/ru/LC_MESSAGES/app.mo");
+    assert(MultilingualCompiler::expand_path("{lang}/app_{lang}.mo", "de") == "de/app_de.mo");
+    
+    bool thrown = false;
+    try {
+        MultilingualCompiler::expand_path("out/app.mo", "ru");
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    thrown = false;
+    try {
+        MultilingualCompiler::expand_path("out/{lang}/app.mo", "../ru");
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "✓ test_multilingual_expand_path passed\n";
+}
+
+void test_multilingual_compile() {
+    fs::create_directories("test_multilingual");
+    std::vector<std::string> outputs = {"test_multilingual/ru.mo", "test_multilingual/de.mo"};
+    
+    Metadata metadata;
+    metadata.project_id_version = "Test 1.0";
+    MultilingualCompiler compiler(metadata, 2);
+    auto counts = compiler.compile(make_catalog(), outputs);
+    assert(counts.size() == 2);
+    assert(counts[0] == 3);
+    assert(counts[1] == 2);
+    
+    gettextify::format::mo::MoParser parser;
+    Catalog russian;
+    parser.parse(outputs[0], russian);
+    assert(russian.size() == 4);
+    assert(russian.get_entries()[0].msgid.empty());
+    assert(russian.get_entries()[0].msgstr.find("Language: ru\n") != std::string::npos);
+    assert(russian.get_entries()[1].msgid == "Apple");
+    assert(russian.get_entries()[2].msgid == "Goodbye");
+    assert(russian.get_entries()[3].msgstr == "Привет");
+    
+    // Empty cells are left out
+    Catalog german;
+    parser.parse(outputs[1], german);
+    assert(german.size() == 3);
+    assert(german.get_entries()[0].msgstr.find("Language: de\n") != std::string::npos);
+    assert(german.get_entries()[1].msgstr == "Apfel");
+    assert(german.get_entries()[2].msgstr == "Hallo");
+    
+    fs::remove_all("test_multilingual");
+    std::cout << "✓ test_multilingual_compile passed\n";
+}
+
+void test_multilingual_compile_threaded() {
+    // One thread per language, all building MO headers at the same time
+    std::vector<std::string> languages;
+    for (int i = 0; i < 8; ++i) {
+        languages.push_back("l" + std::to_string(i));
+    }
+    MultilingualCatalog catalog(languages);
+    for (int row = 0; row < 200; ++row) {
+        std::vector<std::string> msgstrs;
+        for (const auto& language : languages) {
+            msgstrs.push_back(language + " " + std::to_string(row));
+        }
+        catalog.add_row("msgid " + std::to_string(row), std::move(msgstrs));
+    }
+    
+    fs::create_directories("test_multilingual_threaded");
+    std::vector<std::string> outputs;
+    for (const auto& language : languages) {
+        outputs.push_back(MultilingualCompiler::expand_path("test_multilingual_threaded/{lang}.mo",
+                                                            language));
+    }
+    
+    for (int round = 0; round < 10; ++round) {
+        MultilingualCompiler compiler(Metadata(), 8);
+        auto counts = compiler.compile(catalog, outputs);
+        for (size_t count : counts) {
+            assert(count == 200);
+        }
+    }
+    
+    gettextify::format::mo::MoParser parser;
+    for (size_t i = 0; i < languages.size(); ++i) {
+        Catalog compiled;
+        parser.parse(outputs[i], compiled);
+        assert(compiled.size() == 201);
+        assert(compiled.get_entries()[0].msgstr.find("Language: " + languages[i] + "\n") !=
+               std::string::npos);
+    }
+    
+    fs::remove_all("test_multilingual_threaded");
+    std::cout << "✓ test_multilingual_compile_threaded passed\n";
+}
+
+void test_multilingual_rejects_bad_rows() {
+    MultilingualCatalog catalog({"ru", "de"});
+    
+    bool thrown = false;
+    try {
+        catalog.add_row("Hello", {"Привет"});
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(catalog.empty());
+    
+    std::cout << "✓ test_multilingual_rejects_bad_rows passed\n";
+}
+
+int main() {
+    std::cout << "Running Multilingual Compiler tests...\n";
+    
+    test_multilingual_expand_path();
+    test_multilingual_compile();
+    test_multilingual_compile_threaded();
+    test_multilingual_rejects_bad_rows();
+    
+    std::cout << "\nAll Multilingual Compiler tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,113 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "../tm/tm_index.h"
+#include "../core/catalog.h"
+#include <cassert>
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+
+using namespace gettextify::tm;
+using namespace gettextify::core;
+
+namespace fs = std::filesystem;
+
+static Catalog make_memory() {
+    Catalog catalog;
+    catalog.add_entry("Open file", "Открыть файл");
+    catalog.add_entry("Open files", "Открыть файлы");
+    catalog.add_entry("Save file", "Сохранить файл");
+    catalog.add_entry("Close window", "Закрыть окно");
+    catalog.add_entry("Untranslated", "");
+    return catalog;
+}
+
+void test_tm_exact_match() {
+    std::string path = "test_exact.tm";
+    TmIndex::build(make_memory(), path);
+
+    TmIndex index(path);
+    assert(index.size() == 4);
+
+    auto matches = index.lookup("Close window");
+    assert(!matches.empty());
+    assert(matches[0].msgid == "Close window");
+    assert(matches[0].msgstr == "Закрыть окно");
+    assert(matches[0].score == 1.0);
+
+    fs::remove(path);
+    std::cout << "✓ test_tm_exact_match passed\n";
+}
+
+void test_tm_fuzzy_ranking() {
+    std::string path = "test_fuzzy.tm";
+    TmIndex::build(make_memory(), path);
+    TmIndex index(path);
+
+    auto matches = index.lookup("open file...", 3, 0.5);
+    assert(matches.size() >= 2);
+    assert(matches[0].msgid == "Open file");
+    assert(matches[1].msgid == "Open files");
+    assert(matches[0].score > matches[1].score);
+    assert(matches[0].score < 1.0);
+
+    assert(index.lookup("Completely different", 3, 0.5).empty());
+    assert(index.lookup("Untranslated", 3, 0.5).empty());
+
+    fs::remove(path);
+    std::cout << "✓ test_tm_fuzzy_ranking passed\n";
+}
+
+void test_tm_fill_sink() {
+    std::string path = "test_fill.tm";
+    TmIndex::build(make_memory(), path);
+    TmIndex index(path);
+
+    Catalog catalog;
+    TmFillSink sink(index, catalog, 0.8);
+    sink.add_entry(TranslationEntry("Save file", ""));
+    sink.add_entry(TranslationEntry("Open file", "Открыть"));
+    sink.add_entry(TranslationEntry("Quit", ""));
+
+    assert(sink.filled_count() == 1);
+    assert(catalog.size() == 3);
+    assert(catalog.get_entries()[0].msgstr == "Сохранить файл");
+    assert(catalog.get_entries()[1].msgstr == "Открыть");
+    assert(catalog.get_entries()[2].msgstr.empty());
+
+    fs::remove(path);
+    std::cout << "✓ test_tm_fill_sink passed\n";
+}
+
+void test_tm_rejects_invalid_file() {
+    std::string path = "test_invalid.tm";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "msgid,msgstr,comment\n\"Hello\",\"Привет\",\"\"\n";
+    }
+
+    bool thrown = false;
+    try {
+        TmIndex index(path);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    fs::remove(path);
+    std::cout << "✓ test_tm_rejects_invalid_file passed\n";
+}
+
+int main() {
+    std::cout << "Running Translation Memory tests...\n";
+
+    test_tm_exact_match();
+    test_tm_fuzzy_ranking();
+    test_tm_fill_sink();
+    test_tm_rejects_invalid_file();
+
+    std::cout << "\nAll Translation Memory tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,404 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#include "tm_index.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace gettextify {
+namespace tm {
+
+namespace {
+
+// Spans into the mapped posting array
+struct PostingList {
+    const uint32_t* begin;
+    const uint32_t* end;
+
+    size_t size() const { return end - begin; }
+};
+
+unsigned char normalize(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+// Shared trigrams needed for a Dice score of t between sets of size n and m
+size_t required_shared(double t, size_t n, size_t m) {
+    double needed = std::ceil(t * (n + m) / 2.0 - 1e-9);
+    return needed < 1.0 ? 1 : static_cast<size_t>(needed);
+}
+
+// Exponential search for the first element not less than value
+const uint32_t* gallop(const uint32_t* first, const uint32_t* last, uint32_t value) {
+    if (first == last || *first >= value) {
+        return first;
+    }
+    size_t step = 1;
+    const uint32_t* low = first;
+    while (true) {
+        const uint32_t* probe = (static_cast<size_t>(last - low) > step) ? low + step : last;
+        if (probe == last || *probe >= value) {
+            return std::lower_bound(low + 1, probe, value);
+        }
+        low = probe;
+        step <<= 1;
+    }
+}
+
+} // namespace
+
+std::vector<uint32_t> TmIndex::extract_grams(const std::string& str) {
+    std::vector<uint32_t> grams;
+    if (str.empty()) {
+        return grams;
+    }
+
+    // Byte trigrams over the string padded with a zero byte on each side
+    grams.reserve(str.size());
+    uint32_t window = 0;
+    for (size_t i = 0; i <= str.size(); ++i) {
+        unsigned char c = (i < str.size()) ? normalize(str[i]) : 0;
+        window = ((window << 8) | c) & 0xFFFFFF;
+        if (i >= 1) {
+            grams.push_back(window);
+        }
+    }
+
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+void TmIndex::build(const core::Catalog& catalog, const std::string& index_path) {
+    std::vector<EntryRecord> entries;
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    std::string strings;
+
+    auto append_string = [&strings](const std::string& str) {
+        uint64_t offset = strings.size();
+        if (offset + str.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::runtime_error("Translation memory index exceeds 4 GiB");
+        }
+        strings += str;
+        return static_cast<uint32_t>(offset);
+    };
+
+    std::vector<std::pair<const core::TranslationEntry*, std::vector<uint32_t>>> indexed;
+    for (const auto& entry : catalog.get_entries()) {
+        if (!entry.msgid.empty() && !entry.msgstr.empty()) {
+            indexed.emplace_back(&entry, extract_grams(entry.msgid));
+        }
+    }
+
+    // Ids ordered by trigram count turn the length filter into an id range
+    std::stable_sort(indexed.begin(), indexed.end(),
+        [](const auto& a, const auto& b) { return a.second.size() < b.second.size(); });
+
+    for (const auto& item : indexed) {
+        const core::TranslationEntry& entry = *item.first;
+        uint32_t id = static_cast<uint32_t>(entries.size());
+        for (uint32_t gram : item.second) {
+            pairs.emplace_back(gram, id);
+        }
+
+        EntryRecord record;
+        record.msgid_offset = append_string(entry.msgid);
+        record.msgid_length = static_cast<uint32_t>(entry.msgid.size());
+        record.msgstr_offset = append_string(entry.msgstr);
+        record.msgstr_length = static_cast<uint32_t>(entry.msgstr.size());
+        record.gram_count = static_cast<uint32_t>(item.second.size());
+        entries.push_back(record);
+    }
+    indexed.clear();
+
+    // Group postings by trigram; ids stay ascending within each list
+    std::sort(pairs.begin(), pairs.end());
+
+    std::vector<GramRecord> grams;
+    std::vector<uint32_t> postings;
+    postings.reserve(pairs.size());
+    for (const auto& pair : pairs) {
+        if (grams.empty() || grams.back().gram != pair.first) {
+            grams.push_back({pair.first, static_cast<uint32_t>(postings.size()), 0});
+        }
+        ++grams.back().postings_count;
+        postings.push_back(pair.second);
+    }
+
+    uint64_t entries_offset = TM_HEADER_SIZE;
+    uint64_t grams_offset = entries_offset + entries.size() * sizeof(EntryRecord);
+    uint64_t postings_offset = grams_offset + grams.size() * sizeof(GramRecord);
+    uint64_t strings_offset = postings_offset + postings.size() * sizeof(uint32_t);
+    if (strings_offset + strings.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Translation memory index exceeds 4 GiB");
+    }
+
+    std::ofstream file(index_path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot create output file: " + index_path);
+    }
+
+    auto write_u32 = [&file](uint64_t value) {
+        uint32_t v = static_cast<uint32_t>(value);
+        file.write(reinterpret_cast<const char*>(&v), sizeof(v));
+    };
+
+    write_u32(TM_MAGIC);
+    write_u32(TM_FORMAT_REVISION);
+    write_u32(entries.size());
+    write_u32(grams.size());
+    write_u32(entries_offset);
+    write_u32(grams_offset);
+    write_u32(postings_offset);
+    write_u32(strings_offset);
+
+    file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(EntryRecord));
+    file.write(reinterpret_cast<const char*>(grams.data()), grams.size() * sizeof(GramRecord));
+    file.write(reinterpret_cast<const char*>(postings.data()), postings.size() * sizeof(uint32_t));
+    file.write(strings.data(), strings.size());
+
+    if (!file) {
+        throw std::runtime_error("Cannot write output file: " + index_path);
+    }
+}
+
+TmIndex::TmIndex(const std::string& index_path)
+    : file_(std::make_unique<core::MappedFile>(index_path)) {
+    const char* data = file_->data();
+    size_t size = file_->size();
+
+    if (size < TM_HEADER_SIZE) {
+        throw std::runtime_error("Not a translation memory index: " + index_path);
+    }
+
+    uint32_t header[TM_HEADER_SIZE / sizeof(uint32_t)];
+    std::copy(data, data + TM_HEADER_SIZE, reinterpret_cast<char*>(header));
+    if (header[0] != TM_MAGIC || header[1] != TM_FORMAT_REVISION) {
+        throw std::runtime_error("Not a translation memory index: " + index_path);
+    }
+
+    entry_count_ = header[2];
+    gram_count_ = header[3];
+    uint64_t entries_offset = header[4];
+    uint64_t grams_offset = header[5];
+    uint64_t postings_offset = header[6];
+    uint64_t strings_offset = header[7];
+
+    // Sections must be laid out back to back within the file
+    if (entries_offset != TM_HEADER_SIZE ||
+        grams_offset != entries_offset + uint64_t(entry_count_) * sizeof(EntryRecord) ||
+        postings_offset < grams_offset + uint64_t(gram_count_) * sizeof(GramRecord) ||
+        strings_offset < postings_offset || strings_offset > size ||
+        (strings_offset - postings_offset) % sizeof(uint32_t) != 0) {
+        throw std::runtime_error("Corrupted translation memory index: " + index_path);
+    }
+
+    entries_ = reinterpret_cast<const EntryRecord*>(data + entries_offset);
+    grams_ = reinterpret_cast<const GramRecord*>(data + grams_offset);
+    postings_ = reinterpret_cast<const uint32_t*>(data + postings_offset);
+    strings_ = data + strings_offset;
+
+    uint64_t postings_size = (strings_offset - postings_offset) / sizeof(uint32_t);
+    uint64_t strings_size = size - strings_offset;
+    for (uint32_t i = 0; i < gram_count_; ++i) {
+        if (uint64_t(grams_[i].postings_offset) + grams_[i].postings_count > postings_size) {
+            throw std::runtime_error("Corrupted translation memory index: " + index_path);
+        }
+    }
+    for (uint32_t i = 0; i < entry_count_; ++i) {
+        const EntryRecord& e = entries_[i];
+        if (uint64_t(e.msgid_offset) + e.msgid_length > strings_size ||
+            uint64_t(e.msgstr_offset) + e.msgstr_length > strings_size) {
+            throw std::runtime_error("Corrupted translation memory index: " + index_path);
+        }
+    }
+}
+
+size_t TmIndex::size() const {
+    return entry_count_;
+}
+
+std::vector<TmMatch> TmIndex::lookup(const std::string& msgid, size_t max_results,
+                                     double min_score) const {
+    std::vector<TmMatch> results;
+    auto query = extract_grams(msgid);
+    if (query.empty() || max_results == 0) {
+        return results;
+    }
+
+    // Dice >= t requires the entry to share at least t*n/(2-t) of the n query grams
+    double t = std::min(std::max(min_score, 0.0), 1.0);
+    size_t n = query.size();
+    size_t min_shared = static_cast<size_t>(std::ceil(t * n / (2.0 - t) - 1e-9));
+    if (min_shared < 1) {
+        min_shared = 1;
+    }
+
+    // Entry trigram counts outside [min_grams, max_grams] cannot reach min_score
+    double min_grams = t * n / (2.0 - t);
+    double max_grams = (t > 0.0) ? (2.0 - t) * n / t : std::numeric_limits<double>::max();
+    auto by_gram_count = [](const EntryRecord& record, double value) {
+        return record.gram_count < value;
+    };
+    uint32_t first_id = static_cast<uint32_t>(
+        std::lower_bound(entries_, entries_ + entry_count_, min_grams - 1e-9, by_gram_count) -
+        entries_);
+    uint32_t last_id = static_cast<uint32_t>(
+        std::lower_bound(entries_, entries_ + entry_count_, max_grams + 1e-9, by_gram_count) -
+        entries_);
+    if (first_id >= last_id) {
+        return results;
+    }
+
+    // Restrict every posting list to the id range of plausible lengths
+    std::vector<PostingList> lists;
+    lists.reserve(n);
+    for (uint32_t gram : query) {
+        auto it = std::lower_bound(grams_, grams_ + gram_count_, gram,
+            [](const GramRecord& record, uint32_t value) { return record.gram < value; });
+        if (it != grams_ + gram_count_ && it->gram == gram) {
+            const uint32_t* begin = postings_ + it->postings_offset;
+            const uint32_t* end = begin + it->postings_count;
+            lists.push_back({std::lower_bound(begin, end, first_id),
+                             std::lower_bound(begin, end, last_id)});
+        } else {
+            lists.push_back({postings_, postings_});
+        }
+    }
+    std::sort(lists.begin(), lists.end(),
+        [](const PostingList& a, const PostingList& b) { return a.size() < b.size(); });
+
+    // Ids are ordered by trigram count, so each count occupies one id range;
+    // resolving the ranges up front keeps the candidate loops off entries_
+    struct Level {
+        uint32_t first_id;
+        uint32_t required;
+    };
+    std::vector<Level> levels;
+    for (uint32_t id = first_id; id < last_id;) {
+        uint32_t m = entries_[id].gram_count;
+        levels.push_back({id, static_cast<uint32_t>(required_shared(t, n, m))});
+        id = static_cast<uint32_t>(
+            std::upper_bound(entries_ + id, entries_ + last_id, m,
+                [](uint32_t value, const EntryRecord& record) {
+                    return value < record.gram_count;
+                }) - entries_);
+    }
+
+    // Any qualifying entry occurs in at least one of the n - min_shared + 1
+    // rarest lists. Merging them pairwise leaves equal ids adjacent, so the
+    // shared counts fall out of one pass without a per-entry counter array.
+    size_t prefix = n - min_shared + 1;
+    std::vector<uint32_t> merged;
+    std::vector<size_t> runs{0};
+    for (size_t i = 0; i < prefix; ++i) {
+        merged.insert(merged.end(), lists[i].begin, lists[i].end);
+        runs.push_back(merged.size());
+    }
+    std::vector<uint32_t> buffer(merged.size());
+    while (runs.size() > 2) {
+        std::vector<size_t> next{0};
+        for (size_t k = 0; k + 1 < runs.size(); k += 2) {
+            size_t end = (k + 2 < runs.size()) ? runs[k + 2] : runs[k + 1];
+            std::merge(merged.begin() + runs[k], merged.begin() + runs[k + 1],
+                       merged.begin() + runs[k + 1], merged.begin() + end,
+                       buffer.begin() + runs[k]);
+            next.push_back(end);
+        }
+        merged.swap(buffer);
+        runs.swap(next);
+    }
+
+    struct Candidate {
+        uint32_t id;
+        uint32_t shared;
+        uint32_t required;
+    };
+    std::vector<Candidate> candidates;
+    size_t level = 0;
+    for (size_t i = 0; i < merged.size();) {
+        uint32_t id = merged[i];
+        size_t j = i + 1;
+        while (j < merged.size() && merged[j] == id) {
+            ++j;
+        }
+        while (level + 1 < levels.size() && levels[level + 1].first_id <= id) {
+            ++level;
+        }
+        candidates.push_back({id, static_cast<uint32_t>(j - i), levels[level].required});
+        i = j;
+    }
+
+    // Verify against the remaining lists one at a time, dropping candidates
+    // that can no longer reach t*(n+m)/2 shared trigrams
+    for (size_t i = prefix; i < n && !candidates.empty(); ++i) {
+        const uint32_t* cursor = lists[i].begin;
+        size_t remaining = n - i - 1;
+        size_t kept = 0;
+        for (const Candidate& candidate : candidates) {
+            Candidate current = candidate;
+            cursor = gallop(cursor, lists[i].end, current.id);
+            if (cursor != lists[i].end && *cursor == current.id) {
+                ++current.shared;
+            }
+            if (current.shared + remaining >= current.required) {
+                candidates[kept++] = current;
+            }
+        }
+        candidates.resize(kept);
+    }
+
+    struct Scored {
+        uint32_t id;
+        double score;
+    };
+    std::vector<Scored> scored;
+
+    for (const Candidate& candidate : candidates) {
+        uint32_t m = entries_[candidate.id].gram_count;
+        double score = 2.0 * candidate.shared / (n + m);
+        if (score >= t - 1e-9) {
+            scored.push_back({candidate.id, score});
+        }
+    }
+
+    size_t count = std::min(max_results, scored.size());
+    std::partial_sort(scored.begin(), scored.begin() + count, scored.end(),
+        [](const Scored& a, const Scored& b) {
+            return a.score != b.score ? a.score > b.score : a.id < b.id;
+        });
+
+    results.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const EntryRecord& e = entries_[scored[i].id];
+        results.push_back({std::string(strings_ + e.msgid_offset, e.msgid_length),
+                           std::string(strings_ + e.msgstr_offset, e.msgstr_length),
+                           scored[i].score});
+    }
+    return results;
+}
+
+TmFillSink::TmFillSink(const TmIndex& index, core::EntrySink& next, double min_score)
+    : index_(index), next_(next), min_score_(min_score) {}
+
+void TmFillSink::add_entry(core::TranslationEntry&& entry) {
+    if (entry.msgstr.empty() && !entry.msgid.empty()) {
+        auto matches = index_.lookup(entry.msgid, 1, min_score_);
+        if (!matches.empty()) {
+            entry.msgstr = std::move(matches[0].msgstr);
+            ++filled_count_;
+        }
+    }
+    next_.add_entry(std::move(entry));
+}
+
+size_t TmFillSink::filled_count() const {
+    return filled_count_;
+}
+
+} // namespace tm
+} // namespace gettextify
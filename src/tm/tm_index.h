@@ -0,0 +1,108 @@
+// Copyright 2026 AnmiTaliDev <anmitalidev@nuros.org>
+// This code licensed under LGPL 3.0
+
+#ifndef GETTEXTIFY_TM_TM_INDEX_H
+#define GETTEXTIFY_TM_TM_INDEX_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include "../core/catalog.h"
+#include "../core/entry_sink.h"
+#include "../core/mapped_file.h"
+#include "../core/export.h"
+
+namespace gettextify {
+namespace tm {
+
+/**
+ * Translation memory suggestion for a source string
+ */
+struct TmMatch {
+    std::string msgid;
+    std::string msgstr;
+    double score;   // Dice coefficient of the trigram sets, 0.0 to 1.0
+};
+
+/**
+ * Persistent trigram index over translated entries
+ *
+ * The index file holds a sorted trigram table with posting lists and is
+ * memory-mapped on open; the constructor only bounds-checks the entry and
+ * trigram records, so no strings or posting lists are copied. Lookups use
+ * prefix filtering: only the rarest posting lists are merged into
+ * candidates, which are then verified against the longer lists by binary
+ * search.
+ */
+class GETTEXTIFY_API TmIndex {
+public:
+    static constexpr double DEFAULT_MIN_SCORE = 0.7;
+
+    explicit TmIndex(const std::string& index_path);
+
+    /**
+     * Writes an index of all entries with a non-empty msgid and msgstr
+     */
+    static void build(const core::Catalog& catalog, const std::string& index_path);
+
+    std::vector<TmMatch> lookup(const std::string& msgid,
+                                size_t max_results = 5,
+                                double min_score = DEFAULT_MIN_SCORE) const;
+
+    size_t size() const;
+
+private:
+    static constexpr uint32_t TM_MAGIC = 0x314d5447;   // "GTM1"
+    static constexpr uint32_t TM_FORMAT_REVISION = 0;
+    static constexpr size_t TM_HEADER_SIZE = 32;
+
+    struct EntryRecord {
+        uint32_t msgid_offset;
+        uint32_t msgid_length;
+        uint32_t msgstr_offset;
+        uint32_t msgstr_length;
+        uint32_t gram_count;
+    };
+
+    struct GramRecord {
+        uint32_t gram;
+        uint32_t postings_offset;
+        uint32_t postings_count;
+    };
+
+    static std::vector<uint32_t> extract_grams(const std::string& str);
+
+    std::unique_ptr<core::MappedFile> file_;
+    const EntryRecord* entries_ = nullptr;
+    const GramRecord* grams_ = nullptr;
+    const uint32_t* postings_ = nullptr;
+    const char* strings_ = nullptr;
+    uint32_t entry_count_ = 0;
+    uint32_t gram_count_ = 0;
+};
+
+/**
+ * Sink adapter that fills empty msgstrs from a translation memory
+ */
+class GETTEXTIFY_API TmFillSink : public core::EntrySink {
+public:
+    TmFillSink(const TmIndex& index, core::EntrySink& next,
+               double min_score = TmIndex::DEFAULT_MIN_SCORE);
+
+    void add_entry(core::TranslationEntry&& entry) override;
+
+    size_t filled_count() const;
+
+private:
+    const TmIndex& index_;
+    core::EntrySink& next_;
+    double min_score_;
+    size_t filled_count_ = 0;
+};
+
+} // namespace tm
+} // namespace gettextify
+
+#endif // GETTEXTIFY_TM_TM_INDEX_H